@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.h"
+#include <iomanip>
+#include <sstream>
+
+std::ostream &operator<<(std::ostream &stream, bench_dir const &d) {
+  stream << d.description;
+  return stream;
+}
+
+std::vector<bench_dir> GetBenchmarkDirs() {
+  BenchmarkConfiguration &config = BenchmarkConfiguration::GetInstance();
+  std::vector<bench_dir> ret_vec;
+
+  ret_vec.emplace_back(
+      bench_dir{"non-pmem test directory", config.GetTestDir()});
+
+  int i = 0;
+  for (const auto &dir : config.GetNamespaceDirs()) {
+    ret_vec.emplace_back(
+        bench_dir{"namespace " + std::to_string(i++) + " (" + dir + ")", dir});
+  }
+  return ret_vec;
+}
+
+void Benchmark::Report(const std::string &name, double value,
+                       const std::string &unit) {
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(3) << value;
+  RecordProperty(name, stream.str());
+  std::cout << "[  RESULT  ] " << name << ": " << stream.str() << " " << unit
+            << std::endl;
+}
+
+void Benchmark::Report(const std::string &name, const std::string &value) {
+  RecordProperty(name, value);
+  std::cout << "[  RESULT  ] " << name << ": " << value << std::endl;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_BENCHMARK_H
+#define RAS_BENCHMARK_H
+
+#include "benchmark_configuration.h"
+#include "gtest/gtest.h"
+#include "timer/timer.h"
+
+struct bench_dir {
+  std::string description;
+  std::string dir;
+};
+
+std::ostream &operator<<(std::ostream &stream, bench_dir const &d);
+
+/*
+ * GetBenchmarkDirs -- returns non-pmem test directory followed by directories
+ * on all configured mount points.
+ */
+std::vector<bench_dir> GetBenchmarkDirs();
+
+/*
+ * Benchmark -- base fixture for benchmarks. Results are printed and recorded
+ * as test properties, so they are available in gtest XML output.
+ */
+class Benchmark : public ::testing::Test {
+ public:
+  BenchmarkConfiguration &config_ = BenchmarkConfiguration::GetInstance();
+
+ protected:
+  void Report(const std::string &name, double value, const std::string &unit);
+  void Report(const std::string &name, const std::string &value);
+};
+
+#endif  // RAS_BENCHMARK_H
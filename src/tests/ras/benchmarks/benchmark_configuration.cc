@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark_configuration.h"
+
+BenchmarkConfiguration::BenchmarkConfiguration() {
+  if (ReadConfigFile() != 0) {
+    throw std::invalid_argument(
+        "Reading config file for benchmark configuration failed");
+  }
+}
+
+int BenchmarkConfiguration::SetNamespaceDirs(pugi::xml_node &&node) {
+  for (auto &&it : node.children("mountPoint")) {
+    std::string mountpoint = it.text().get();
+    if (!ApiC::DirectoryExists(mountpoint)) {
+      std::cerr << "Directory " << mountpoint << " does not exist."
+                << std::endl;
+      return -1;
+    }
+
+    std::string dir = mountpoint + "/pmdk_tests/";
+    if (!ApiC::DirectoryExists(dir) && ApiC::CreateDirectoryT(dir) != 0) {
+      std::cerr << "Could not create: " << dir << std::endl;
+      return -1;
+    }
+    namespace_dirs_.emplace_back(dir);
+  }
+
+  return 0;
+}
+
+int BenchmarkConfiguration::SetPoolsetFiles(pugi::xml_node &&node) {
+  for (auto &&it : node.children("poolsetFile")) {
+    std::string path = it.text().get();
+    if (!ApiC::RegularFileExists(path)) {
+      std::cerr << "Pool set file " << path << " does not exist." << std::endl;
+      return -1;
+    }
+    poolset_files_.emplace_back(path);
+  }
+
+  return 0;
+}
+
+int BenchmarkConfiguration::FillConfigFields(pugi::xml_node &&root) {
+  root = root.child("localConfiguration");
+
+  if (root.empty()) {
+    std::cerr << "Cannot find 'localConfiguration' node" << std::endl;
+    return -1;
+  }
+
+  /* dimmConfiguration section is optional for benchmarks */
+  if (SetTestDir(root, test_dir_) != 0 ||
+      SetNamespaceDirs(root.child("dimmConfiguration")) != 0 ||
+      SetPoolsetFiles(root.child("poolsetFiles")) != 0) {
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_BENCHMARK_CONFIGURATION_H
+#define RAS_BENCHMARK_CONFIGURATION_H
+
+#include "configXML/read_config.h"
+#include "pugixml.hpp"
+
+/*
+ * BenchmarkConfiguration -- class that provides benchmarks with test
+ * directories from 'localConfiguration' section of config file. Mount points
+ * listed in 'dimmConfiguration' are used as plain directories, so benchmarks
+ * can be run without NVDIMM hardware (e.g. on tmpfs).
+ */
+class BenchmarkConfiguration final
+    : public ReadConfig<BenchmarkConfiguration> {
+ private:
+  friend class ReadConfig<BenchmarkConfiguration>;
+  std::string test_dir_;
+  std::vector<std::string> namespace_dirs_;
+  std::vector<std::string> poolset_files_;
+  int FillConfigFields(pugi::xml_node &&root);
+  int SetNamespaceDirs(pugi::xml_node &&node);
+  int SetPoolsetFiles(pugi::xml_node &&node);
+  BenchmarkConfiguration();
+
+ public:
+  /*
+   * GetInstance -- returns configuration read on first call. Throws
+   * std::invalid_argument if config file is invalid.
+   */
+  static BenchmarkConfiguration &GetInstance() {
+    static BenchmarkConfiguration config;
+    return config;
+  }
+
+  const std::string &GetTestDir() const {
+    return this->test_dir_;
+  }
+
+  /*
+   * GetNamespaceDirs -- returns 'pmdk_tests' directories created on all
+   * configured mount points.
+   */
+  const std::vector<std::string> &GetNamespaceDirs() const {
+    return this->namespace_dirs_;
+  }
+
+  /*
+   * GetPoolsetFiles -- returns paths of existing pool set files listed in
+   * optional 'poolsetFiles' node.
+   */
+  const std::vector<std::string> &GetPoolsetFiles() const {
+    return this->poolset_files_;
+  }
+};
+
+#endif  // RAS_BENCHMARK_CONFIGURATION_H
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hugepage_benchmark.h"
+#include "perf_counter/perf_counter.h"
+
+void HugePageMapping::SetUp() {
+  pool_path_ = GetParam().dir + "hugepage_benchmark_pool";
+  ASSERT_LE(static_cast<long long>(pool_size_),
+            ApiC::GetFreeSpaceT(GetParam().dir))
+      << "Insufficient free space in " << GetParam().dir;
+}
+
+void HugePageMapping::TearDown() {
+  if (pop_) {
+    pmemobj_close(pop_);
+  }
+  ApiC::RemoveFile(pool_path_);
+}
+
+uint64_t HugePageMapping::RandomRead(const uint64_t *base, size_t len) const {
+  size_t words = len / sizeof(uint64_t);
+  size_t mask = 1;
+  while ((mask << 1) <= words) {
+    mask <<= 1;
+  }
+  mask -= 1;
+
+  uint64_t sum = 0;
+  uint64_t x = 0x9E3779B97F4A7C15ULL;
+  for (size_t i = 0; i < accesses_; ++i) {
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    sum += base[(x >> 16) & mask];
+  }
+  return sum;
+}
+
+/**
+ * RANDOM_READ
+ * Check page sizes the pool is mapped with and measure cost of random reads
+ * from the pool mapping.
+ * \test
+ *          \li \c Step1. Create obj pool in directory given by parameter /
+ * SUCCESS
+ *          \li \c Step2. Touch every page of the pool / SUCCESS
+ *          \li \c Step3. Read page sizes of pool mapping from /proc/self/smaps
+ * / SUCCESS
+ *          \li \c Step4. Read random words from the pool counting dTLB misses
+ * / SUCCESS
+ *          \li \c Step5. Report results, warn if any part of the pool is
+ * mapped with 4 KiB pages. If no memory is accounted in smaps, as for DAX
+ * mappings, judge page size by alignment of the mapping and file extents /
+ * SUCCESS
+ */
+TEST_P(HugePageMapping, RANDOM_READ) {
+  /* Step1 */
+  pop_ = pmemobj_create(pool_path_.c_str(), nullptr, pool_size_, 0644);
+  ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+
+  /* Step2 */
+  const uint64_t *base = reinterpret_cast<const uint64_t *>(pop_);
+  volatile uint64_t sink = 0;
+  for (size_t off = 0; off < pool_size_ / sizeof(uint64_t);
+       off += 4 * KIBIBYTE / sizeof(uint64_t)) {
+    sink += base[off];
+  }
+
+  /* Step3 */
+  std::vector<mapping_info> mappings;
+  ASSERT_EQ(0, MappingInfo::ReadMappings(pop_, pool_size_, mappings));
+
+  /* Step4 */
+  PerfCounter dtlb_misses{PerfEvent::dtlb_load_misses};
+  Timer timer;
+  dtlb_misses.Start();
+  timer.Start();
+  sink += RandomRead(base, pool_size_);
+  timer.Stop();
+  dtlb_misses.Stop();
+
+  /* Step5 */
+  size_t huge_mapped = 0;
+  for (const auto &m : mappings) {
+    huge_mapped += MappingInfo::GetHugeMapped(m);
+  }
+  PageSizeVerdict verdict = MappingInfo::GetVerdict(mappings);
+  /* DAX mappings are not accounted in Rss, judge them by alignment */
+  bool by_alignment = verdict == PageSizeVerdict::unknown;
+  if (by_alignment) {
+    verdict = MappingInfo::GetAlignmentVerdict(mappings);
+    Report("aligned_share", 100 * MappingInfo::GetAlignedShare(mappings),
+           "%");
+  }
+
+  Report("mappings", mappings.size(), "");
+  Report("kernel_page_size", mappings.front().kernel_page_size / KIBIBYTE,
+         "KiB");
+  Report("huge_mapped", static_cast<double>(huge_mapped) / MEBIBYTE, "MiB");
+  Report("huge_share", 100 * MappingInfo::GetHugeShare(mappings), "%");
+  Report("page_size_verdict", MappingInfo::ToString(verdict));
+  Report("page_size_verdict_source", by_alignment ? "alignment" : "rss");
+  Report("random_read_latency",
+         timer.GetElapsed<std::chrono::nanoseconds>() / accesses_, "ns");
+  if (dtlb_misses.IsAvailable()) {
+    Report("dtlb_misses_per_read",
+           static_cast<double>(dtlb_misses.Read()) / accesses_, "");
+  } else {
+    Report("dtlb_misses_per_read", "unavailable");
+  }
+
+  if (verdict == PageSizeVerdict::fallback) {
+    std::cerr << "[ WARNING  ] Pool in " << GetParam().dir
+              << " is mapped with 4 KiB pages" << std::endl;
+  } else if (verdict == PageSizeVerdict::partial) {
+    std::cerr << "[ WARNING  ] Pool in " << GetParam().dir
+              << " is partially mapped with 4 KiB pages" << std::endl;
+  } else if (verdict == PageSizeVerdict::unknown) {
+    std::cerr << "[ WARNING  ] Page size of pool in " << GetParam().dir
+              << " cannot be determined" << std::endl;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark, HugePageMapping,
+                        ::testing::ValuesIn(GetBenchmarkDirs()));
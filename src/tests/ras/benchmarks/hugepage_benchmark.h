@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_HUGEPAGE_BENCHMARK_H
+#define RAS_HUGEPAGE_BENCHMARK_H
+
+#include "benchmark.h"
+#include "libpmemobj.h"
+#include "mapping_info/mapping_info.h"
+
+class HugePageMapping : public Benchmark,
+                        public ::testing::WithParamInterface<bench_dir> {
+ public:
+  const size_t pool_size_ = 512 * MEBIBYTE;
+  const size_t accesses_ = 16 * MEBIBYTE;
+  std::string pool_path_;
+  PMEMobjpool *pop_ = nullptr;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * RandomRead -- reads 'accesses_' randomly chosen 8-byte words from given
+   * range. Returns sum of read values.
+   */
+  uint64_t RandomRead(const uint64_t *base, size_t len) const;
+};
+
+#endif  // RAS_HUGEPAGE_BENCHMARK_H
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "poolset_options_benchmark.h"
+#include <algorithm>
+#include "poolset/poolset_management.h"
+
+std::ostream &operator<<(std::ostream &stream, options_layout const &l) {
+  stream << l.description;
+  return stream;
+}
+
+void PoolsetOptions::SetUp() {
+  std::vector<std::string> dirs = config_.GetNamespaceDirs();
+  if (dirs.empty()) {
+    dirs.emplace_back(config_.GetTestDir());
+  }
+  for (const auto &dir : dirs) {
+    ASSERT_LE(static_cast<long long>(pool_size_ / dirs.size() + part_size_),
+              ApiC::GetFreeSpaceT(dir))
+        << "Insufficient free space in " << dir;
+  }
+
+  const std::string name = "poolset_options";
+  switch (GetParam().layout) {
+    case OptionsLayout::parts:
+      poolset_ = StripedPoolset::Generate(dirs, name, pool_size_, part_size_);
+      break;
+    case OptionsLayout::singlehdr:
+      poolset_ = StripedPoolset::Generate(dirs, name, pool_size_, part_size_,
+                                          {PoolsetOption::singlehdr});
+      break;
+    case OptionsLayout::nohdrs:
+      poolset_ = StripedPoolset::Generate(dirs, name, pool_size_, part_size_,
+                                          {PoolsetOption::nohdrs});
+      break;
+    case OptionsLayout::directories:
+      poolset_ = StripedPoolset::GenerateDirectories(dirs, name, pool_size_);
+      for (const auto &part : poolset_.GetParts()) {
+        ASSERT_EQ(0, ApiC::CreateDirectoryT(part.GetPath()));
+      }
+      break;
+  }
+
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(poolset_));
+  ASSERT_EQ(0, p_mgmt.PreallocateParts(poolset_));
+}
+
+void PoolsetOptions::TearDown() {
+  PoolsetManagement p_mgmt;
+  p_mgmt.RemovePartsFromPoolset(poolset_);
+  for (const auto &part : poolset_.GetParts()) {
+    if (part.IsDirectory()) {
+      ApiC::RemoveDirectoryT(part.GetPath());
+    }
+  }
+  p_mgmt.RemovePoolsetFile(poolset_);
+}
+
+size_t PoolsetOptions::GetUsableCapacity(PMEMobjpool *pop) const {
+  const size_t MIN_ALLOC_SIZE = 256 * KIBIBYTE;
+  std::vector<PMEMoid> oids;
+  size_t usable = 0;
+
+  for (size_t size = pool_size_; size >= MIN_ALLOC_SIZE;) {
+    PMEMoid oid;
+    if (pmemobj_alloc(pop, &oid, size, 0, nullptr, nullptr) == 0) {
+      oids.emplace_back(oid);
+      usable += size;
+    } else {
+      size /= 2;
+    }
+  }
+
+  for (auto &oid : oids) {
+    pmemobj_free(&oid);
+  }
+  return usable;
+}
+
+/**
+ * CAPACITY_AND_OPEN
+ * Compare usable capacity and open latency of pools created from poolset with
+ * many parts, given option or directory parts.
+ * \test
+ *          \li \c Step1. Create poolset with 64 parts placed across configured
+ * mount points according to layout given by parameter / SUCCESS
+ *          \li \c Step2. Create pool from the poolset / SUCCESS, FAILURE is
+ * reported for NOHDRS option if not supported by libpmemobj
+ *          \li \c Step3. Allocate objects until the pool is full, report usable
+ * capacity and overhead / SUCCESS
+ *          \li \c Step4. Close and open the pool repeatedly, report average and
+ * maximal open time / SUCCESS
+ */
+TEST_P(PoolsetOptions, CAPACITY_AND_OPEN) {
+  /* Step2 */
+  PMEMobjpool *pop =
+      pmemobj_create(poolset_.GetFullPath().c_str(), nullptr, 0, 0644);
+  if (pop == nullptr && GetParam().layout == OptionsLayout::nohdrs) {
+    Report("create", std::string{"unsupported: "} + pmemobj_errormsg());
+    return;
+  }
+  ASSERT_TRUE(pop != nullptr) << "Pool creating failed. Errno: " << errno
+                              << std::endl
+                              << pmemobj_errormsg();
+
+  /* Step3 */
+  size_t usable = GetUsableCapacity(pop);
+  pmemobj_close(pop);
+  Report("usable_capacity", static_cast<double>(usable) / MEBIBYTE, "MiB");
+  Report("overhead", static_cast<double>(pool_size_ - usable) / MEBIBYTE,
+         "MiB");
+
+  /* Step4 */
+  double total_ms = 0;
+  double max_ms = 0;
+  for (int i = 0; i < opens_; ++i) {
+    Timer timer;
+    timer.Start();
+    pop = pmemobj_open(poolset_.GetFullPath().c_str(), nullptr);
+    timer.Stop();
+    ASSERT_TRUE(pop != nullptr) << "Pool opening failed. Errno: " << errno
+                                << std::endl
+                                << pmemobj_errormsg();
+    pmemobj_close(pop);
+    total_ms += timer.GetElapsed();
+    max_ms = std::max(max_ms, timer.GetElapsed());
+  }
+  Report("open_avg_ms", total_ms / opens_, "ms");
+  Report("open_max_ms", max_ms, "ms");
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Benchmark, PoolsetOptions,
+    ::testing::Values(
+        options_layout{"64 parts", OptionsLayout::parts},
+        options_layout{"64 parts, OPTION SINGLEHDR", OptionsLayout::singlehdr},
+        options_layout{"64 parts, OPTION NOHDRS", OptionsLayout::nohdrs},
+        options_layout{"directory parts", OptionsLayout::directories}));
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_POOLSET_OPTIONS_BENCHMARK_H
+#define RAS_POOLSET_OPTIONS_BENCHMARK_H
+
+#include "benchmark.h"
+#include "libpmemobj.h"
+#include "striped_poolset/striped_poolset.h"
+
+enum class OptionsLayout { parts, singlehdr, nohdrs, directories };
+
+struct options_layout {
+  std::string description;
+  OptionsLayout layout;
+};
+
+std::ostream &operator<<(std::ostream &stream, options_layout const &l);
+
+class PoolsetOptions : public Benchmark,
+                       public ::testing::WithParamInterface<options_layout> {
+ public:
+  const size_t pool_size_ = 512 * MEBIBYTE;
+  const size_t part_size_ = 8 * MEBIBYTE;
+  const int opens_ = 20;
+  Poolset poolset_;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * GetUsableCapacity -- allocates objects as big as possible until the pool
+   * is full, frees them and returns their total size.
+   */
+  size_t GetUsableCapacity(PMEMobjpool *pop) const;
+};
+
+#endif  // RAS_POOLSET_OPTIONS_BENCHMARK_H
@@ -0,0 +1,311 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "poolset_parser_benchmark.h"
+#include <cstring>
+#include <utility>
+#include "poolset/poolset_builder.h"
+#include "poolset/poolset_management.h"
+
+void PoolsetParsing::SetUp() {
+  poolset_dir_ = config_.GetTestDir();
+}
+
+void PoolsetParsing::TearDown() {
+  for (const auto &path : created_files_) {
+    ApiC::RemoveFile(path);
+  }
+}
+
+int PoolsetParsing::RoundTrip(const Poolset &poolset, Poolset &parsed,
+                              double &parse_ms) {
+  PoolsetManagement p_mgmt;
+  if (p_mgmt.CreatePoolsetFile(poolset) != 0) {
+    return -1;
+  }
+  created_files_.emplace_back(poolset.GetFullPath());
+
+  Timer timer;
+  timer.Start();
+  int ret = PoolsetParser::Parse(poolset.GetFullPath(), parsed);
+  timer.Stop();
+  parse_ms = timer.GetElapsed();
+  return ret;
+}
+
+int PoolsetParsing::RoundTripFile(const std::string &path, Poolset &parsed,
+                                  Poolset &reparsed, double &parse_ms) {
+  Timer timer;
+  timer.Start();
+  int ret = PoolsetParser::Parse(path, parsed);
+  timer.Stop();
+  parse_ms = timer.GetElapsed();
+  if (ret != 0) {
+    return -1;
+  }
+
+  Poolset copy{poolset_dir_, "configured_copy.set", parsed.GetReplicas(),
+               parsed.GetOptions()};
+  double reparse_ms;
+  return RoundTrip(copy, reparsed, reparse_ms);
+}
+
+/**
+ * ROUND_TRIP_SYNTAX
+ * Parse pool set content with comments, empty lines and irregular blanks.
+ * \test
+ *          \li \c Step1. Parse content of pool set file with comments, empty
+ * lines, tabs, CRLF line endings, option and directory part / SUCCESS
+ *          \li \c Step2. Verify replicas, sizes of parsed parts and options /
+ * SUCCESS
+ *          \li \c Step3. Parse content generated from parsed poolset, verify
+ * it is the same / SUCCESS
+ */
+TEST_F(PoolsetParsing, ROUND_TRIP_SYNTAX) {
+  /* Step1 */
+  const char content[] =
+      "# production pool set\n"
+      "\n"
+      "PMEMPOOLSET\r\n"
+      "OPTION SINGLEHDR\n"
+      "  9MB /mnt/pmem0/pool.part0  # first part\n"
+      "\t1GiB\t/mnt/pmem1/pool.part1\n"
+      "REPLICA\n"
+      "\n"
+      "2G /mnt/pmem2/replica.part0\n"
+      "4G /mnt/pmem2/replica_dir/";
+  Poolset parsed;
+  ASSERT_EQ(0, PoolsetParser::Parse(content, sizeof(content) - 1,
+                                    poolset_dir_, "syntax.set", parsed));
+
+  /* Step2 */
+  std::vector<std::string> expected{"PMEMPOOLSET",
+                                    "OPTION SINGLEHDR",
+                                    "9MB /mnt/pmem0/pool.part0",
+                                    "1GiB /mnt/pmem1/pool.part1",
+                                    "REPLICA",
+                                    "2G /mnt/pmem2/replica.part0",
+                                    "4G /mnt/pmem2/replica_dir/"};
+  ASSERT_EQ(expected, parsed.GetContent());
+  ASSERT_EQ(2u, parsed.GetReplicas().size());
+  ASSERT_EQ(9 * MEGABYTE, parsed.GetReplica(0).GetPart(0).GetSize());
+  ASSERT_EQ(GIGIBYTE, parsed.GetReplica(0).GetPart(1).GetSize());
+  ASSERT_EQ(2 * GIGIBYTE, parsed.GetReplica(1).GetPart(0).GetSize());
+  ASSERT_TRUE(parsed.GetReplica(1).GetPart(1).IsDirectory());
+  ASSERT_EQ(1u, parsed.GetOptions().size());
+  ASSERT_EQ(PoolsetOption::singlehdr, parsed.GetOptions().front());
+
+  /* Step3 */
+  Poolset reparsed;
+  double parse_ms;
+  ASSERT_EQ(0, RoundTrip(parsed, reparsed, parse_ms));
+  ASSERT_EQ(parsed.GetContent(), reparsed.GetContent());
+}
+
+/**
+ * SIZE_UNITS
+ * Parse part sizes with every suffix accepted in pool set files.
+ * \test
+ *          \li \c Step1. Parse size with every suffix / SUCCESS
+ *          \li \c Step2. Verify size in bytes and that text form of the size
+ * is preserved / SUCCESS
+ */
+TEST_F(PoolsetParsing, SIZE_UNITS) {
+  const std::vector<std::pair<std::string, size_t>> sizes{
+      {"3", 3},
+      {"3B", 3},
+      {"3K", 3 * KIBIBYTE},
+      {"3KB", 3 * KILOBYTE},
+      {"3KiB", 3 * KIBIBYTE},
+      {"3M", 3 * MEBIBYTE},
+      {"3MB", 3 * MEGABYTE},
+      {"3MiB", 3 * MEBIBYTE},
+      {"3G", 3 * GIGIBYTE},
+      {"3GB", 3 * GIGABYTE},
+      {"3GiB", 3 * GIGIBYTE},
+      {"3T", 3 * TEBIBYTE},
+      {"3TB", 3 * TERABYTE},
+      {"3TiB", 3 * TEBIBYTE},
+      {"3P", 3 * PEBIBYTE},
+      {"3PB", 3 * PETABYTE},
+      {"3PiB", 3 * PEBIBYTE},
+      {"16383PiB", 16383 * PEBIBYTE}};
+  for (const auto &size : sizes) {
+    /* Step1 */
+    size_t value;
+    SizeUnit unit;
+    ASSERT_EQ(0, Part::ParseSize(size.first, value, unit)) << size.first;
+
+    /* Step2 */
+    Part part{value, unit, "/mnt/pmem0/pool.part0"};
+    EXPECT_EQ(size.second, part.GetSize()) << size.first;
+    EXPECT_EQ(size.first, part.GetSizeString());
+  }
+}
+
+/**
+ * MALFORMED
+ * Parse invalid pool set contents.
+ * \test
+ *          \li \c Step1. Parse every invalid content / FAILURE
+ */
+TEST_F(PoolsetParsing, MALFORMED) {
+  /* Step1 */
+  const char *contents[] = {
+      "",
+      "# comment only\n",
+      "9MB /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\n",
+      "PMEMPOOLSET\n9XB /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\n9MB\n",
+      "PMEMPOOLSET\n9MB /mnt/pmem0/pool.part0 extra\n",
+      "PMEMPOOLSET\n9MB /mnt/pmem0/pool.part0\nREPLICA\n",
+      "PMEMPOOLSET\n9MB /mnt/pmem0/pool.part0\nREPLICA host pool.set\n",
+      "PMEMPOOLSET\n99999999999999999999MB /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\n16384PiB /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\n18446744073709551615K /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\n9iB /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\nOPTION UNKNOWN\n9MB /mnt/pmem0/pool.part0\n",
+      "PMEMPOOLSET\n9MB /mnt/pmem0/pool.part0\nREPLICA\nOPTION SINGLEHDR\n"
+      "9MB /mnt/pmem1/replica.part0\n"};
+  for (const auto content : contents) {
+    Poolset parsed;
+    EXPECT_EQ(-1, PoolsetParser::Parse(content, std::strlen(content),
+                                       poolset_dir_, "malformed.set", parsed))
+        << "Content parsed unexpectedly:\n"
+        << content;
+  }
+}
+
+/**
+ * ROUND_TRIP_GENERATED
+ * Parse generated pool set files with growing number of parts.
+ * \test
+ *          \li \c Step1. Generate poolset with master and secondary replica,
+ * each with given number of parts spread across configured directories /
+ * SUCCESS
+ *          \li \c Step2. Write pool set file and parse it / SUCCESS
+ *          \li \c Step3. Verify content of parsed poolset is the same, report
+ * parsing time / SUCCESS
+ */
+TEST_F(PoolsetParsing, ROUND_TRIP_GENERATED) {
+  std::vector<std::string> dirs = config_.GetNamespaceDirs();
+  if (dirs.empty()) {
+    dirs.emplace_back(poolset_dir_);
+  }
+
+  for (size_t parts : {1, 100, 10000}) {
+    /* Step1 */
+    const std::string name = "generated_" + std::to_string(parts) + ".set";
+    Poolset poolset = PoolsetBuilder{poolset_dir_, name}
+                          .AddReplica()
+                          .AddParts(parts, 2, SizeUnit::mib, dirs, "master")
+                          .AddReplica()
+                          .AddParts(parts, 2, SizeUnit::mb, dirs, "replica")
+                          .Build();
+
+    /* Step2 */
+    Poolset parsed;
+    double parse_ms;
+    ASSERT_EQ(0, RoundTrip(poolset, parsed, parse_ms));
+
+    /* Step3 */
+    ASSERT_EQ(poolset.GetContent(), parsed.GetContent());
+    Report("parse_" + std::to_string(parts) + "_parts", parse_ms, "ms");
+  }
+}
+
+/**
+ * ROUND_TRIP_CONFIGURED
+ * Parse pool set files listed in 'poolsetFiles' config node.
+ * \test
+ *          \li \c Step1. Parse every configured pool set file / SUCCESS
+ *          \li \c Step2. Write content of parsed poolset to a file and parse it
+ * again / SUCCESS
+ *          \li \c Step3. Verify both poolsets have the same content, report
+ * parsing time / SUCCESS
+ */
+TEST_F(PoolsetParsing, ROUND_TRIP_CONFIGURED) {
+  if (config_.GetPoolsetFiles().empty()) {
+    std::cout << "No pool set files configured in 'poolsetFiles' node"
+              << std::endl;
+    return;
+  }
+
+  for (const auto &path : config_.GetPoolsetFiles()) {
+    /* Step1, Step2 */
+    Poolset parsed;
+    Poolset reparsed;
+    double parse_ms;
+    ASSERT_EQ(0, RoundTripFile(path, parsed, reparsed, parse_ms));
+
+    /* Step3 */
+    ASSERT_EQ(parsed.GetContent(), reparsed.GetContent());
+    Report(parsed.GetName() + "_parts", parsed.GetParts().size(), "");
+    Report(parsed.GetName() + "_parse", parse_ms, "ms");
+  }
+}
+
+/**
+ * ROUND_TRIP_CONFIGURED_OPTIONS
+ * Parse pool set file with options the same way as files given in config.
+ * \test
+ *          \li \c Step1. Write pool set file with options and parse it /
+ * SUCCESS
+ *          \li \c Step2. Write content of parsed poolset to a file and parse it
+ * again / SUCCESS
+ *          \li \c Step3. Verify both poolsets have the same content and
+ * options / SUCCESS
+ */
+TEST_F(PoolsetParsing, ROUND_TRIP_CONFIGURED_OPTIONS) {
+  /* Step1 */
+  const std::string path = poolset_dir_ + "/configured_options.set";
+  ASSERT_EQ(0, ApiC::CreateFileT(path,
+                                 "PMEMPOOLSET\n"
+                                 "OPTION SINGLEHDR\n"
+                                 "9MB /mnt/pmem0/pool.part0\n"
+                                 "9MB /mnt/pmem0/pool.part1\n"
+                                 "REPLICA\n"
+                                 "18MB /mnt/pmem1/replica.part0\n"));
+  created_files_.emplace_back(path);
+
+  /* Step2 */
+  Poolset parsed;
+  Poolset reparsed;
+  double parse_ms;
+  ASSERT_EQ(0, RoundTripFile(path, parsed, reparsed, parse_ms));
+
+  /* Step3 */
+  ASSERT_EQ(parsed.GetContent(), reparsed.GetContent());
+  ASSERT_EQ(1u, reparsed.GetOptions().size());
+  ASSERT_EQ(PoolsetOption::singlehdr, reparsed.GetOptions().front());
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_POOLSET_PARSER_BENCHMARK_H
+#define RAS_POOLSET_PARSER_BENCHMARK_H
+
+#include "benchmark.h"
+#include "poolset/poolset_parser.h"
+
+class PoolsetParsing : public Benchmark {
+ public:
+  std::string poolset_dir_;
+  std::vector<std::string> created_files_;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * RoundTrip -- writes content of 'poolset' to a file, parses it back into
+   * 'parsed' and records parsing time in 'parse_ms'. Returns 0 on success,
+   * -1 otherwise.
+   */
+  int RoundTrip(const Poolset &poolset, Poolset &parsed, double &parse_ms);
+
+  /*
+   * RoundTripFile -- parses pool set file of given path into 'parsed' and
+   * records parsing time in 'parse_ms', then writes copy of parsed poolset
+   * with its options to test directory and parses it into 'reparsed'. Returns
+   * 0 on success, -1 otherwise.
+   */
+  int RoundTripFile(const std::string &path, Poolset &parsed,
+                    Poolset &reparsed, double &parse_ms);
+};
+
+#endif  // RAS_POOLSET_PARSER_BENCHMARK_H
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "poolset_validation_benchmark.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include "poolset/poolset_builder.h"
+#include "poolset/poolset_management.h"
+
+void PoolsetValidation::SetUp() {
+  const std::string dir = GetParam().dir + "validation_benchmark/";
+  ASSERT_TRUE(ApiC::DirectoryExists(dir) || ApiC::CreateDirectoryT(dir) == 0)
+      << "Could not create " << dir;
+  poolset_ = PoolsetBuilder{GetParam().dir, "validation_benchmark.set"}
+                 .AddReplica()
+                 .AddParts(parts_, 2, SizeUnit::mib, {dir}, "pool")
+                 .Build();
+
+  /* parts are sparse, so the benchmark does not depend on free space */
+  for (const auto &part : poolset_.GetReplica(0).GetParts()) {
+    int fd = open(part.GetPath().c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                  mode_ & 0777);
+    ASSERT_NE(-1, fd) << "Creating " << part.GetPath() << " failed";
+    int ret = ftruncate(fd, static_cast<off_t>(part.GetSize()));
+    close(fd);
+    ASSERT_EQ(0, ret) << "Resizing " << part.GetPath() << " failed";
+    ASSERT_EQ(0, ApiC::SetFilePermission(part.GetPath(), mode_ & 0777));
+  }
+}
+
+void PoolsetValidation::TearDown() {
+  PoolsetManagement p_mgmt;
+  p_mgmt.RemovePartsFromPoolset(poolset_);
+  ApiC::RemoveDirectoryT(GetParam().dir + "validation_benchmark/");
+}
+
+int PoolsetValidation::ValidatePerPart() const {
+  PoolsetManagement p_mgmt;
+  if (!p_mgmt.AllFilesExist(poolset_)) {
+    return -1;
+  }
+  for (const auto &part : poolset_.GetReplica(0).GetParts()) {
+    if (ApiC::GetFileSize(part.GetPath()) !=
+        static_cast<long long>(part.GetSize())) {
+      return -1;
+    }
+  }
+  for (const auto &part : poolset_.GetReplica(0).GetParts()) {
+    if (ApiC::GetFilePermission(part.GetPath()) != mode_) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * VALIDATE
+ * Compare time of validating pool set with 1000 parts using separate lookups
+ * per part and using PoolsetValidator.
+ * \test
+ *          \li \c Step1. Validate the pool set with lookups by path of every
+ * part / SUCCESS
+ *          \li \c Step2. Validate the pool set with PoolsetValidator using one
+ * worker / SUCCESS
+ *          \li \c Step3. Validate the pool set with PoolsetValidator using
+ * default number of workers / SUCCESS
+ *          \li \c Step4. Report validation times and speedup / SUCCESS
+ */
+TEST_P(PoolsetValidation, VALIDATE) {
+  /* Step1 */
+  Timer timer;
+  timer.Start();
+  ASSERT_EQ(0, ValidatePerPart());
+  timer.Stop();
+  double per_part_ms = timer.GetElapsed();
+
+  /* Step2 */
+  timer.Start();
+  ASSERT_EQ(0, PoolsetValidator{1}.Validate(poolset_, mode_));
+  timer.Stop();
+  double single_worker_ms = timer.GetElapsed();
+
+  /* Step3 */
+  timer.Start();
+  ASSERT_EQ(0, PoolsetValidator{}.Validate(poolset_, mode_));
+  timer.Stop();
+  double batched_ms = timer.GetElapsed();
+
+  /* Step4 */
+  Report("parts", parts_, "");
+  Report("per_part_ms", per_part_ms, "ms");
+  Report("single_worker_ms", single_worker_ms, "ms");
+  Report("batched_ms", batched_ms, "ms");
+  Report("speedup", batched_ms > 0 ? per_part_ms / batched_ms : 0, "x");
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark, PoolsetValidation,
+                        ::testing::ValuesIn(GetBenchmarkDirs()));
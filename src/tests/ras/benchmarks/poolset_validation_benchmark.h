@@ -0,0 +1,57 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef RAS_POOLSET_VALIDATION_BENCHMARK_H
+#define RAS_POOLSET_VALIDATION_BENCHMARK_H
+
+#include <sys/stat.h>
+#include "benchmark.h"
+#include "poolset/poolset_validator.h"
+
+class PoolsetValidation : public Benchmark,
+                          public ::testing::WithParamInterface<bench_dir> {
+ public:
+  const size_t parts_ = 1000;
+  const int mode_ = S_IFREG | 0644;
+  Poolset poolset_;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * ValidatePerPart -- checks existence, size and mode of every part with
+   * separate lookups by path, the way pool sets were validated before
+   * PoolsetValidator. Returns 0 on success, -1 otherwise.
+   */
+  int ValidatePerPart() const;
+};
+
+#endif  // RAS_POOLSET_VALIDATION_BENCHMARK_H
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "replica_diff_benchmark.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <random>
+#include <set>
+
+void ReplicaDiff::SetUp() {
+  path_ = GetParam().dir + "replica_diff_benchmark";
+  copy_path_ = path_ + "_copy";
+  ASSERT_LE(static_cast<long long>(2 * file_size_),
+            ApiC::GetFreeSpaceT(GetParam().dir))
+      << "Insufficient free space in " << GetParam().dir;
+
+  std::mt19937_64 generator{file_size_};
+  buffer_.resize(buffer_size_);
+  for (size_t i = 0; i < buffer_size_; i += sizeof(uint64_t)) {
+    uint64_t value = generator();
+    std::memcpy(&buffer_[i], &value, sizeof(value));
+  }
+}
+
+void ReplicaDiff::TearDown() {
+  ApiC::RemoveFile(path_);
+  ApiC::RemoveFile(copy_path_);
+}
+
+int ReplicaDiff::WriteFile(const std::string &path) const {
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    std::cerr << "Creating " << path << " failed" << std::endl;
+    return -1;
+  }
+  int ret = 0;
+  for (size_t written = 0; written < file_size_ && ret == 0;
+       written += buffer_size_) {
+    if (write(fd, buffer_.data(), buffer_size_) !=
+        static_cast<ssize_t>(buffer_size_)) {
+      std::cerr << "Writing " << path << " failed" << std::endl;
+      ret = -1;
+    }
+  }
+  close(fd);
+  return ret;
+}
+
+double ReplicaDiff::HashThroughput(uint64_t (*hash)(const void *,
+                                                    size_t)) const {
+  volatile uint64_t sink = 0;
+  Timer timer;
+  timer.Start();
+  for (size_t off = 0; off < buffer_size_; off += MerkleTree::BLOCK_SIZE) {
+    sink += hash(&buffer_[off], MerkleTree::BLOCK_SIZE);
+  }
+  timer.Stop();
+  return static_cast<double>(buffer_size_) / GIGIBYTE /
+         (timer.GetElapsed() / 1000);
+}
+
+/**
+ * BUILD_AND_DIFF
+ * Measure throughput of block hashing and of building Merkle trees of file,
+ * compare trees of file and its copy with modified blocks.
+ * \test
+ *          \li \c Step1. Hash buffer in memory with scalar and AVX2
+ * implementations / SUCCESS
+ *          \li \c Step2. Create file and its copy with randomly chosen blocks
+ * modified / SUCCESS
+ *          \li \c Step3. Build tree of the file with one worker and with one
+ * worker per CPU / SUCCESS
+ *          \li \c Step4. Build tree of the copy, compare trees, confirm only
+ * modified blocks are reported / SUCCESS
+ *          \li \c Step5. Report throughputs and comparison time / SUCCESS
+ */
+TEST_P(ReplicaDiff, BUILD_AND_DIFF) {
+  /* Step1 */
+  double scalar_throughput = HashThroughput(BlockHash::HashScalar);
+
+  /* Step2 */
+  ASSERT_EQ(0, WriteFile(path_));
+  ASSERT_EQ(0, WriteFile(copy_path_));
+  std::mt19937_64 generator{modified_blocks_};
+  std::set<size_t> blocks;
+  while (blocks.size() < modified_blocks_) {
+    blocks.insert(generator() % (file_size_ / MerkleTree::BLOCK_SIZE));
+  }
+  int fd = open(copy_path_.c_str(), O_WRONLY);
+  ASSERT_NE(-1, fd);
+  for (auto block : blocks) {
+    size_t offset = block * MerkleTree::BLOCK_SIZE + block % 4096;
+    unsigned char byte = ~buffer_[offset % buffer_size_];
+    ASSERT_EQ(1, pwrite(fd, &byte, 1, static_cast<off_t>(offset)));
+  }
+  close(fd);
+
+  /* Step3 */
+  std::vector<data_segment> file{{path_, 0, 0}};
+  std::vector<data_segment> copy{{copy_path_, 0, 0}};
+  MerkleTree tree;
+  Timer timer;
+  timer.Start();
+  ASSERT_EQ(0, MerkleTree::Build(file, 0, tree, 1));
+  timer.Stop();
+  double single_worker_ms = timer.GetElapsed();
+
+  timer.Start();
+  ASSERT_EQ(0, MerkleTree::Build(file, 0, tree));
+  timer.Stop();
+  double build_ms = timer.GetElapsed();
+
+  /* Step4 */
+  MerkleTree copy_tree;
+  ASSERT_EQ(0, MerkleTree::Build(copy, 0, copy_tree));
+  timer.Start();
+  std::vector<diff_range> ranges = tree.Diff(copy_tree);
+  timer.Stop();
+  double diff_ms = timer.GetElapsed();
+  ASSERT_EQ(modified_blocks_ * MerkleTree::BLOCK_SIZE,
+            MerkleTree::GetDiffSize(ranges));
+  for (const auto &range : ranges) {
+    ASSERT_EQ(1u, blocks.count(range.offset / MerkleTree::BLOCK_SIZE));
+  }
+
+  /* Step5 */
+  double gib = static_cast<double>(file_size_) / GIGIBYTE;
+  Report("hash_scalar_throughput", scalar_throughput, "GiB/s");
+  if (BlockHash::IsSimdAvailable()) {
+    Report("hash_simd_throughput", HashThroughput(BlockHash::HashSimd),
+           "GiB/s");
+  } else {
+    Report("hash_simd_throughput", "unavailable");
+  }
+  Report("build_single_worker_throughput", gib / (single_worker_ms / 1000),
+         "GiB/s");
+  Report("build_throughput", gib / (build_ms / 1000), "GiB/s");
+  Report("diff", diff_ms, "ms");
+  Report("diff_ranges", ranges.size(), "");
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark, ReplicaDiff,
+                        ::testing::ValuesIn(GetBenchmarkDirs()));
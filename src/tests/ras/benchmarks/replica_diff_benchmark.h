@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef RAS_REPLICA_DIFF_BENCHMARK_H
+#define RAS_REPLICA_DIFF_BENCHMARK_H
+
+#include "benchmark.h"
+#include "replica_diff/merkle_tree.h"
+
+class ReplicaDiff : public Benchmark,
+                    public ::testing::WithParamInterface<bench_dir> {
+ public:
+  const size_t file_size_ = GIGIBYTE;
+  const size_t buffer_size_ = 64 * MEBIBYTE;
+  const size_t modified_blocks_ = 16;
+  std::vector<unsigned char> buffer_;
+  std::string path_;
+  std::string copy_path_;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * WriteFile -- fills file in given path with content of 'buffer_' repeated
+   * up to 'file_size_'. Returns 0 on success, -1 otherwise.
+   */
+  int WriteFile(const std::string &path) const;
+
+  /*
+   * HashThroughput -- returns throughput of given hash function hashing
+   * 'buffer_' in 4 KiB blocks, in GiB/s.
+   */
+  double HashThroughput(uint64_t (*hash)(const void *, size_t)) const;
+};
+
+#endif  // RAS_REPLICA_DIFF_BENCHMARK_H
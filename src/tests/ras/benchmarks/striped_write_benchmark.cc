@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "striped_write_benchmark.h"
+#include <future>
+#include "poolset/poolset_management.h"
+
+std::ostream &operator<<(std::ostream &stream, write_layout const &l) {
+  stream << l.description;
+  return stream;
+}
+
+std::vector<write_layout> GetWriteLayouts() {
+  BenchmarkConfiguration &config = BenchmarkConfiguration::GetInstance();
+  const auto &dirs = config.GetNamespaceDirs();
+  std::vector<write_layout> ret_vec;
+
+  if (dirs.empty()) {
+    ret_vec.emplace_back(
+        write_layout{"non-pmem test directory", {config.GetTestDir()}});
+    return ret_vec;
+  }
+
+  if (dirs.size() > 1) {
+    ret_vec.emplace_back(write_layout{
+        "striped across " + std::to_string(dirs.size()) + " namespaces", dirs});
+  }
+  for (size_t i = 0; i < dirs.size(); ++i) {
+    ret_vec.emplace_back(write_layout{
+        "namespace " + std::to_string(i) + " (" + dirs[i] + ")", {dirs[i]}});
+  }
+  return ret_vec;
+}
+
+void StripedWrite::SetUp() {
+  const auto &dirs = GetParam().dirs;
+  size_t parts = pool_size_ / part_size_;
+  size_t parts_per_dir = (parts + dirs.size() - 1) / dirs.size();
+  for (const auto &dir : dirs) {
+    ASSERT_LE(static_cast<long long>(parts_per_dir * part_size_),
+              ApiC::GetFreeSpaceT(dir))
+        << "Insufficient free space in " << dir;
+  }
+
+  poolset_ = StripedPoolset::Generate(dirs, "striped_benchmark", pool_size_,
+                                      part_size_);
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(poolset_));
+  ASSERT_EQ(0, p_mgmt.PreallocateParts(poolset_));
+  pop_ = pmemobj_create(poolset_.GetFullPath().c_str(), nullptr, 0, 0644);
+  ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+}
+
+void StripedWrite::TearDown() {
+  if (pop_) {
+    pmemobj_close(pop_);
+  }
+  PoolsetManagement p_mgmt;
+  p_mgmt.RemovePartsFromPoolset(poolset_);
+  p_mgmt.RemovePoolsetFile(poolset_);
+}
+
+unsigned StripedWrite::GetWriters() const {
+  size_t dirs = config_.GetNamespaceDirs().size();
+  return dirs > 1 ? static_cast<unsigned>(dirs) : 1;
+}
+
+double StripedWrite::Write(bool random, unsigned writers) {
+  PMEMoid oid;
+  if (pmemobj_alloc(pop_, &oid, buffer_size_, 0, nullptr, nullptr) != 0) {
+    std::cerr << "Buffer allocation failed: " << pmemobj_errormsg()
+              << std::endl;
+    return 0;
+  }
+  char *buffer = static_cast<char *>(pmemobj_direct(oid));
+  const std::vector<char> block(block_size_, 'x');
+  const size_t blocks = buffer_size_ / block_size_ / writers;
+
+  auto writer = [&](unsigned index) {
+    char *region = buffer + index * blocks * block_size_;
+    uint64_t x = 0x9E3779B97F4A7C15ULL + index;
+    for (size_t i = 0; i < blocks; ++i) {
+      size_t b = i;
+      if (random) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        b = (x >> 16) % blocks;
+      }
+      pmemobj_memcpy_persist(pop_, region + b * block_size_, block.data(),
+                             block_size_);
+    }
+  };
+
+  Timer timer;
+  timer.Start();
+  std::vector<std::future<void>> workers;
+  for (unsigned i = 0; i < writers; ++i) {
+    workers.emplace_back(std::async(std::launch::async, writer, i));
+  }
+  for (auto &w : workers) {
+    w.get();
+  }
+  timer.Stop();
+
+  pmemobj_free(&oid);
+  return static_cast<double>(blocks * writers * block_size_) / MEBIBYTE /
+         timer.GetElapsed<std::chrono::seconds>();
+}
+
+/**
+ * SEQUENTIAL_WRITE
+ * Measure bandwidth of sequential writes to pool placed according to layout
+ * given by parameter.
+ * \test
+ *          \li \c Step1. Create poolset with parts placed according to layout,
+ * preallocate parts and create obj pool / SUCCESS
+ *          \li \c Step2. Write buffer object in 4 KiB blocks sequentially with
+ * single thread / SUCCESS
+ *          \li \c Step3. Write buffer object sequentially with one thread per
+ * configured mount point, each thread writing its own region / SUCCESS
+ *          \li \c Step4. Report bandwidth, skip Step3 if single mount point is
+ * configured / SUCCESS
+ */
+TEST_P(StripedWrite, SEQUENTIAL_WRITE) {
+  /* Step2 */
+  double single = Write(false, 1);
+  ASSERT_GT(single, 0);
+  Report("sequential_write_1_thread", single, "MiB/s");
+
+  /* Step3 */
+  unsigned writers = GetWriters();
+  if (writers > 1) {
+    double parallel = Write(false, writers);
+    ASSERT_GT(parallel, 0);
+
+    /* Step4 */
+    Report("sequential_write_" + std::to_string(writers) + "_threads", parallel,
+           "MiB/s");
+  }
+}
+
+/**
+ * RANDOM_WRITE
+ * Measure bandwidth of random writes to pool placed according to layout given
+ * by parameter.
+ * \test
+ *          \li \c Step1. Create poolset with parts placed according to layout,
+ * preallocate parts and create obj pool / SUCCESS
+ *          \li \c Step2. Write 4 KiB blocks at random offsets of buffer object
+ * with single thread / SUCCESS
+ *          \li \c Step3. Write 4 KiB blocks at random offsets with one thread
+ * per configured mount point, each thread writing its own region / SUCCESS
+ *          \li \c Step4. Report bandwidth, skip Step3 if single mount point is
+ * configured / SUCCESS
+ */
+TEST_P(StripedWrite, RANDOM_WRITE) {
+  /* Step2 */
+  double single = Write(true, 1);
+  ASSERT_GT(single, 0);
+  Report("random_write_1_thread", single, "MiB/s");
+
+  /* Step3 */
+  unsigned writers = GetWriters();
+  if (writers > 1) {
+    double parallel = Write(true, writers);
+    ASSERT_GT(parallel, 0);
+
+    /* Step4 */
+    Report("random_write_" + std::to_string(writers) + "_threads", parallel,
+           "MiB/s");
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark, StripedWrite,
+                        ::testing::ValuesIn(GetWriteLayouts()));
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_STRIPED_WRITE_BENCHMARK_H
+#define RAS_STRIPED_WRITE_BENCHMARK_H
+
+#include "benchmark.h"
+#include "libpmemobj.h"
+#include "striped_poolset/striped_poolset.h"
+
+struct write_layout {
+  std::string description;
+  std::vector<std::string> dirs;
+};
+
+std::ostream &operator<<(std::ostream &stream, write_layout const &l);
+
+/*
+ * GetWriteLayouts -- returns layout striped across all configured mount points
+ * followed by single-namespace layouts, one per mount point.
+ */
+std::vector<write_layout> GetWriteLayouts();
+
+class StripedWrite : public Benchmark,
+                     public ::testing::WithParamInterface<write_layout> {
+ public:
+  const size_t pool_size_ = GIGIBYTE;
+  const size_t part_size_ = 64 * MEBIBYTE;
+  const size_t buffer_size_ = 512 * MEBIBYTE;
+  const size_t block_size_ = 4 * KIBIBYTE;
+  Poolset poolset_;
+  PMEMobjpool *pop_ = nullptr;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * Write -- writes whole buffer object in blocks with pmemobj_memcpy_persist.
+   * Buffer is divided between 'writers' threads, each writes its blocks in
+   * order or at random offsets. Returns write bandwidth in MiB/s.
+   */
+  double Write(bool random, unsigned writers);
+
+  /*
+   * GetWriters -- returns number of writer threads matching number of
+   * configured mount points.
+   */
+  unsigned GetWriters() const;
+};
+
+#endif  // RAS_STRIPED_WRITE_BENCHMARK_H
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sync_benchmark.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include "pool_data/pool_data.h"
+
+std::ostream &operator<<(std::ostream &stream, sync_layout const &l) {
+  stream << l.description;
+  return stream;
+}
+
+std::vector<sync_layout> GetSyncLayouts() {
+  BenchmarkConfiguration &config = BenchmarkConfiguration::GetInstance();
+  std::vector<std::string> dirs = config.GetNamespaceDirs();
+  if (dirs.empty()) {
+    dirs.emplace_back(config.GetTestDir());
+  }
+
+  std::vector<sync_layout> ret_vec;
+  for (size_t size : {64 * MEBIBYTE, 256 * MEBIBYTE, GIGIBYTE}) {
+    for (size_t parts : {1, 4, 16}) {
+      std::string desc = std::to_string(size / MEBIBYTE) + " MiB replica, " +
+                         std::to_string(parts) + " parts, ";
+      ret_vec.emplace_back(sync_layout{desc + "shared namespace", size, parts,
+                                       dirs[0], dirs[0]});
+      if (dirs.size() > 1) {
+        ret_vec.emplace_back(sync_layout{desc + "separate namespaces", size,
+                                         parts, dirs[0], dirs[1]});
+      }
+    }
+  }
+  return ret_vec;
+}
+
+void SyncThroughput::SetUp() {
+  const sync_layout &l = GetParam();
+  long long required = static_cast<long long>(
+      l.master_dir == l.replica_dir ? 2 * l.replica_size : l.replica_size);
+  ASSERT_LE(required, ApiC::GetFreeSpaceT(l.master_dir))
+      << "Insufficient free space in " << l.master_dir;
+  ASSERT_LE(static_cast<long long>(l.replica_size),
+            ApiC::GetFreeSpaceT(l.replica_dir))
+      << "Insufficient free space in " << l.replica_dir;
+
+  const size_t part_size = l.replica_size / l.parts / MEBIBYTE;
+  poolset_ = PoolsetBuilder{l.master_dir, "sync_benchmark.set"}
+                 .AddReplica()
+                 .AddParts(l.parts, part_size, SizeUnit::mib, {l.master_dir},
+                           "sync_benchmark_master")
+                 .AddReplica()
+                 .AddParts(l.parts, part_size, SizeUnit::mib, {l.replica_dir},
+                           "sync_benchmark_replica")
+                 .Build();
+
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(poolset_));
+  ASSERT_EQ(0, p_mgmt.PreallocateParts(poolset_));
+  PMEMobjpool *pop =
+      pmemobj_create(poolset_.GetFullPath().c_str(), nullptr, 0, 0644);
+  ASSERT_TRUE(pop != nullptr) << "Pool creating failed. Errno: " << errno
+                              << std::endl
+                              << pmemobj_errormsg();
+  ObjData<int> pd{pop};
+  int ret = pd.Write(obj_data_);
+  pmemobj_close(pop);
+  ASSERT_EQ(0, ret) << "Writing to pool failed";
+}
+
+void SyncThroughput::TearDown() {
+  PoolsetManagement p_mgmt;
+  p_mgmt.RemovePartsFromPoolset(poolset_);
+  p_mgmt.RemovePoolsetFile(poolset_);
+}
+
+void SyncThroughput::SyncReplica(const std::string &name,
+                                 size_t rebuilt_size) {
+  Timer timer;
+  timer.Start();
+  ASSERT_EQ(0, pmempool_sync(poolset_.GetFullPath().c_str(), 0))
+      << "Syncing replica failed: " << pmempool_errormsg();
+  timer.Stop();
+
+  PMEMobjpool *pop = pmemobj_open(poolset_.GetFullPath().c_str(), nullptr);
+  ASSERT_TRUE(pop != nullptr) << "Pool opening failed. Errno: " << errno
+                              << std::endl
+                              << pmemobj_errormsg();
+  ObjData<int> pd{pop};
+  bool equal = obj_data_ == pd.Read();
+  pmemobj_close(pop);
+  ASSERT_TRUE(equal) << "Data read from synced pool differs from written";
+
+  double seconds = timer.GetElapsed<std::chrono::seconds>();
+  Report(name + "_ms", timer.GetElapsed(), "ms");
+  Report(name + "_rebuilt_size",
+         static_cast<double>(rebuilt_size) / MEBIBYTE, "MiB");
+  Report(name + "_throughput",
+         static_cast<double>(rebuilt_size) / GIGIBYTE / seconds, "GiB/s");
+}
+
+/**
+ * REBUILD_REMOVED
+ * Measure time of rebuilding removed replica with pmempool_sync.
+ * \test
+ *          \li \c Step1. Create poolset with master and secondary replica
+ * according to layout given by parameter, write data to the pool / SUCCESS
+ *          \li \c Step2. Remove all parts of the secondary replica / SUCCESS
+ *          \li \c Step3. Sync the poolset, verify data / SUCCESS
+ *          \li \c Step4. Report rebuild time and throughput / SUCCESS
+ */
+TEST_P(SyncThroughput, REBUILD_REMOVED) {
+  /* Step2 */
+  PoolsetManagement p_mgmt;
+  size_t removed_size = 0;
+  for (const auto &part : poolset_.GetReplica(1).GetParts()) {
+    ASSERT_EQ(0, p_mgmt.RemovePart(part));
+    removed_size += part.GetSize();
+  }
+
+  /* Step3, Step4 */
+  SyncReplica("rebuild_removed", removed_size);
+}
+
+/**
+ * REBUILD_DAMAGED
+ * Measure time of rebuilding replica with damaged header with pmempool_sync.
+ * \test
+ *          \li \c Step1. Create poolset with master and secondary replica
+ * according to layout given by parameter, write data to the pool / SUCCESS
+ *          \li \c Step2. Overwrite header of the first part of the secondary
+ * replica with zeros / SUCCESS
+ *          \li \c Step3. Sync the poolset, verify data / SUCCESS
+ *          \li \c Step4. Report rebuild time and throughput of the damaged
+ * part, which is the only one pmempool_sync recreates / SUCCESS
+ */
+TEST_P(SyncThroughput, REBUILD_DAMAGED) {
+  /* Step2 */
+  const Part &part = poolset_.GetReplica(1).GetPart(0);
+  const std::string &path = part.GetPath();
+  const std::vector<char> zeros(POOL_HDR_SIZE, 0);
+  int fd = open(path.c_str(), O_WRONLY);
+  ASSERT_NE(-1, fd) << "Opening " << path << " failed";
+  ssize_t written = pwrite(fd, zeros.data(), zeros.size(), 0);
+  int ret = fsync(fd);
+  close(fd);
+  ASSERT_EQ(static_cast<ssize_t>(zeros.size()), written);
+  ASSERT_EQ(0, ret);
+
+  /* Step3, Step4 */
+  SyncReplica("rebuild_damaged", part.GetSize());
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark, SyncThroughput,
+                        ::testing::ValuesIn(GetSyncLayouts()));
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_SYNC_BENCHMARK_H
+#define RAS_SYNC_BENCHMARK_H
+
+#include "benchmark.h"
+#include "libpmemobj.h"
+#include "libpmempool.h"
+#include "poolset/poolset_builder.h"
+#include "poolset/poolset_management.h"
+
+struct sync_layout {
+  std::string description;
+  size_t replica_size;
+  size_t parts;
+  std::string master_dir;
+  std::string replica_dir;
+};
+
+std::ostream &operator<<(std::ostream &stream, sync_layout const &l);
+
+/*
+ * GetSyncLayouts -- returns layouts of poolset with master and one secondary
+ * replica, sweeping replica size, number of parts per replica and whether the
+ * replicas share a namespace. Layouts with replicas on different namespaces
+ * are returned only if at least two mount points are configured.
+ */
+std::vector<sync_layout> GetSyncLayouts();
+
+class SyncThroughput : public Benchmark,
+                       public ::testing::WithParamInterface<sync_layout> {
+ public:
+  Poolset poolset_;
+  std::vector<int> obj_data_{std::vector<int>(100, 0xAB)};
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * SyncReplica -- syncs the poolset, verifies data written in SetUp() and
+   * reports rebuild time and throughput of given number of rebuilt bytes
+   * with given name prefix.
+   */
+  void SyncReplica(const std::string &name, size_t rebuilt_size);
+};
+
+#endif  // RAS_SYNC_BENCHMARK_H
@@ -0,0 +1,251 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "transform_benchmark.h"
+#include <algorithm>
+#include "pool_data/pool_data.h"
+
+std::ostream &operator<<(std::ostream &stream, transform_param const &p) {
+  stream << p.description;
+  return stream;
+}
+
+/*
+ * GetTransformDirs -- returns directories of master replica, replica A and
+ * replica B. Directories are reused if fewer mount points are configured.
+ */
+static std::vector<std::string> GetTransformDirs() {
+  BenchmarkConfiguration &config = BenchmarkConfiguration::GetInstance();
+  std::vector<std::string> dirs = config.GetNamespaceDirs();
+  if (dirs.empty()) {
+    dirs.emplace_back(config.GetTestDir());
+  }
+
+  std::vector<std::string> ret_vec;
+  for (size_t i = 0; i < 3; ++i) {
+    ret_vec.emplace_back(dirs[i % dirs.size()]);
+  }
+  return ret_vec;
+}
+
+std::vector<transform_param> GetTransformParams() {
+  const size_t MIN_SIZE = 64 * MEBIBYTE;
+  std::vector<std::string> dirs = GetTransformDirs();
+
+  /* every directory has to hold all replicas placed in it */
+  size_t max_size = 0;
+  for (const auto &dir : dirs) {
+    size_t replicas =
+        static_cast<size_t>(std::count(dirs.begin(), dirs.end(), dir));
+    long long free_space = ApiC::GetFreeSpaceT(dir);
+    size_t size =
+        free_space > 0 ? static_cast<size_t>(free_space) / replicas : 0;
+    max_size = max_size == 0 ? size : std::min(max_size, size);
+  }
+  /* leave 10% of free space, parts are aligned to 2 MiB */
+  max_size = max_size / 10 * 9 / (2 * MEBIBYTE) * (2 * MEBIBYTE);
+
+  std::vector<transform_param> ret_vec;
+  size_t size = MIN_SIZE;
+  for (; size <= max_size; size *= 2) {
+    ret_vec.emplace_back(
+        transform_param{std::to_string(size / MEBIBYTE) + " MiB", size});
+  }
+  if (max_size >= MIN_SIZE && size / 2 != max_size) {
+    ret_vec.emplace_back(transform_param{
+        std::to_string(max_size / MEBIBYTE) + " MiB (capacity)", max_size});
+  }
+  return ret_vec;
+}
+
+void TransformThroughput::SetUp() {
+  std::vector<std::string> dirs = GetTransformDirs();
+  const size_t size = GetParam().pool_size / MEBIBYTE;
+  const Part master{size, SizeUnit::mib, dirs[0] + "transform_master"};
+  const Part replica_a{size, SizeUnit::mib, dirs[1] + "transform_replica_a"};
+  const Part replica_b{size, SizeUnit::mib, dirs[2] + "transform_replica_b"};
+
+  origin_ = PoolsetBuilder{dirs[0], "transform_origin.set"}
+                .AddReplica()
+                .AddPart(master)
+                .Build();
+  with_a_ = PoolsetBuilder{dirs[0], "transform_a.set"}
+                .AddReplica()
+                .AddPart(master)
+                .AddReplica()
+                .AddPart(replica_a)
+                .Build();
+  with_ab_ = PoolsetBuilder{dirs[0], "transform_ab.set"}
+                 .AddReplica()
+                 .AddPart(master)
+                 .AddReplica()
+                 .AddPart(replica_a)
+                 .AddReplica()
+                 .AddPart(replica_b)
+                 .Build();
+  with_b_ = PoolsetBuilder{dirs[0], "transform_b.set"}
+                .AddReplica()
+                .AddPart(master)
+                .AddReplica()
+                .AddPart(replica_b)
+                .Build();
+
+  PoolsetManagement p_mgmt;
+  for (const auto poolset : {&origin_, &with_a_, &with_ab_, &with_b_}) {
+    ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(*poolset));
+  }
+}
+
+void TransformThroughput::TearDown() {
+  PoolsetManagement p_mgmt;
+  p_mgmt.RemovePartsFromPoolset(with_ab_);
+  for (const auto poolset : {&origin_, &with_a_, &with_ab_, &with_b_}) {
+    p_mgmt.RemovePoolsetFile(*poolset);
+  }
+}
+
+void TransformThroughput::CreatePool(const Poolset &poolset) {
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.PreallocateParts(poolset));
+  PMEMobjpool *pop =
+      pmemobj_create(poolset.GetFullPath().c_str(), nullptr, 0, 0644);
+  ASSERT_TRUE(pop != nullptr) << "Pool creating failed. Errno: " << errno
+                              << std::endl
+                              << pmemobj_errormsg();
+  ObjData<int> pd{pop};
+  int ret = pd.Write(obj_data_);
+  pmemobj_close(pop);
+  ASSERT_EQ(0, ret) << "Writing to pool failed";
+}
+
+void TransformThroughput::Transform(const std::string &name,
+                                    const std::vector<transform_step> &steps,
+                                    size_t copied) {
+  Timer downtime;
+  Timer transform;
+  downtime.Start();
+  transform.Start();
+  for (const auto &step : steps) {
+    ASSERT_EQ(0, pmempool_transform(step.first->GetFullPath().c_str(),
+                                    step.second->GetFullPath().c_str(), 0))
+        << "Transforming " << step.first->GetName() << " to "
+        << step.second->GetName() << " failed: " << pmempool_errormsg();
+  }
+  transform.Stop();
+
+  PMEMobjpool *pop =
+      pmemobj_open(steps.back().second->GetFullPath().c_str(), nullptr);
+  ASSERT_TRUE(pop != nullptr) << "Pool opening failed. Errno: " << errno
+                              << std::endl
+                              << pmemobj_errormsg();
+  ObjData<int> pd{pop};
+  bool equal = obj_data_ == pd.Read();
+  pmemobj_close(pop);
+  downtime.Stop();
+  ASSERT_TRUE(equal) << "Data read from transformed pool differs from written";
+
+  Report(name + "_transform_ms", transform.GetElapsed(), "ms");
+  if (copied > 0) {
+    Report(name + "_throughput",
+           static_cast<double>(copied) / GIGIBYTE /
+               transform.GetElapsed<std::chrono::seconds>(),
+           "GiB/s");
+  }
+  Report(name + "_downtime_ms", downtime.GetElapsed(), "ms");
+}
+
+/**
+ * ADD_REPLICA
+ * Measure time of adding replica to the pool with pmempool_transform.
+ * \test
+ *          \li \c Step1. Create pool with master replica only, write data /
+ * SUCCESS
+ *          \li \c Step2. Transform the pool adding replica on another mount
+ * point / SUCCESS
+ *          \li \c Step3. Open the pool, verify data, report transformation
+ * time, throughput and downtime / SUCCESS
+ */
+TEST_P(TransformThroughput, ADD_REPLICA) {
+  /* Step1 */
+  ASSERT_NO_FATAL_FAILURE(CreatePool(origin_));
+
+  /* Step2, Step3 */
+  Transform("add", {transform_step{&origin_, &with_a_}}, GetParam().pool_size);
+}
+
+/**
+ * REMOVE_REPLICA
+ * Measure time of removing replica from the pool with pmempool_transform.
+ * \test
+ *          \li \c Step1. Create pool with master and secondary replica, write
+ * data / SUCCESS
+ *          \li \c Step2. Transform the pool removing the secondary replica /
+ * SUCCESS
+ *          \li \c Step3. Open the pool, verify data, report transformation
+ * time and downtime / SUCCESS
+ */
+TEST_P(TransformThroughput, REMOVE_REPLICA) {
+  /* Step1 */
+  ASSERT_NO_FATAL_FAILURE(CreatePool(with_a_));
+
+  /* Step2, Step3 */
+  Transform("remove", {transform_step{&with_a_, &origin_}}, 0);
+}
+
+/**
+ * MOVE_REPLICA
+ * Measure time of moving replica between mount points with pmempool_transform.
+ * Transformation cannot add and remove replicas at once, so the replica is
+ * added on target mount point first and then removed from the source one.
+ * \test
+ *          \li \c Step1. Create pool with master and secondary replica, write
+ * data / SUCCESS
+ *          \li \c Step2. Transform the pool adding replica on another mount
+ * point / SUCCESS
+ *          \li \c Step3. Transform the pool removing the original secondary
+ * replica / SUCCESS
+ *          \li \c Step4. Open the pool, verify data, report transformation
+ * time, throughput and downtime / SUCCESS
+ */
+TEST_P(TransformThroughput, MOVE_REPLICA) {
+  /* Step1 */
+  ASSERT_NO_FATAL_FAILURE(CreatePool(with_a_));
+
+  /* Step2, Step3, Step4 */
+  Transform("move",
+            {transform_step{&with_a_, &with_ab_},
+             transform_step{&with_ab_, &with_b_}},
+            GetParam().pool_size);
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark, TransformThroughput,
+                        ::testing::ValuesIn(GetTransformParams()));
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RAS_TRANSFORM_BENCHMARK_H
+#define RAS_TRANSFORM_BENCHMARK_H
+
+#include <utility>
+#include "benchmark.h"
+#include "libpmemobj.h"
+#include "libpmempool.h"
+#include "poolset/poolset_builder.h"
+#include "poolset/poolset_management.h"
+
+struct transform_param {
+  std::string description;
+  size_t pool_size;
+};
+
+std::ostream &operator<<(std::ostream &stream, transform_param const &p);
+
+/*
+ * GetTransformParams -- returns pool sizes doubled from 64 MiB up to the
+ * largest size for which master and two replicas fit in configured mount
+ * points.
+ */
+std::vector<transform_param> GetTransformParams();
+
+using transform_step = std::pair<const Poolset *, const Poolset *>;
+
+class TransformThroughput
+    : public Benchmark,
+      public ::testing::WithParamInterface<transform_param> {
+ public:
+  /* master only, master with replica A, with replicas A and B, with B */
+  Poolset origin_;
+  Poolset with_a_;
+  Poolset with_ab_;
+  Poolset with_b_;
+  std::vector<int> obj_data_{std::vector<int>(100, 0xAB)};
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * CreatePool -- creates pool from given poolset and writes test data.
+   */
+  void CreatePool(const Poolset &poolset);
+
+  /*
+   * Transform -- runs given transformations one after another, opens the
+   * resulting pool and verifies data. Reports transformation time, throughput
+   * of copying 'copied' bytes and total downtime, counted until the pool is
+   * opened again, with given name prefix.
+   */
+  void Transform(const std::string &name,
+                 const std::vector<transform_step> &steps, size_t copied);
+};
+
+#endif  // RAS_TRANSFORM_BENCHMARK_H
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "usc_benchmark.h"
+
+/**
+ * NDCTL_VS_PMEM2
+ * Compare cost of checking unsafe shutdown count of all configured namespaces
+ * with ndctl SMART commands and with libpmem2
+ * \test
+ *          \li \c Step1. Read local DIMM configuration, walking ndctl buses /
+ * SUCCESS
+ *          \li \c Step2. Read USC of every DIMM with SMART command repeatedly,
+ * report average time of single check / SUCCESS
+ *          \li \c Step3. Read USC of every namespace with libpmem2 repeatedly,
+ * report average time of single check / SUCCESS
+ *          \li \c Step4. Report whether sum of DIMM USCs matches USC read by
+ * libpmem2 for every namespace / SUCCESS
+ */
+TEST_F(UscLookup, NDCTL_VS_PMEM2) {
+  /* Step1 */
+  Timer timer;
+  timer.Start();
+  int ret = dimm_config_.ReadConfigFile();
+  timer.Stop();
+  if (ret != 0 || dimm_config_.GetSize() == 0) {
+    Report("usc_lookup", "unavailable");
+    return;
+  }
+  Report("ndctl_setup", timer.GetElapsed(), "ms");
+
+  /* Step2 */
+  std::vector<long long> ndctl_usc(dimm_config_.GetSize(), 0);
+  size_t commands = 0;
+  timer.Start();
+  for (int i = 0; i < checks_; ++i) {
+    for (size_t n = 0; n < dimm_config_.GetSize(); ++n) {
+      ndctl_usc[n] = 0;
+      for (const auto &d : dimm_config_[n]) {
+        ndctl_usc[n] += d.GetShutdownCount();
+        ++commands;
+      }
+    }
+  }
+  timer.Stop();
+  Report("ndctl_check", timer.GetElapsed<std::chrono::microseconds>() / checks_,
+         "us");
+  Report("ndctl_commands_per_check", static_cast<double>(commands) / checks_,
+         "");
+
+  /* Step3 */
+  std::vector<pmem2_usc> pmem2_usc(dimm_config_.GetSize());
+  timer.Start();
+  for (int i = 0; i < checks_; ++i) {
+    for (size_t n = 0; n < dimm_config_.GetSize(); ++n) {
+      ASSERT_EQ(0, Pmem2Usc::ReadForDir(dimm_config_[n].GetTestDir(),
+                                        pmem2_usc[n]));
+    }
+  }
+  timer.Stop();
+  Report("pmem2_check", timer.GetElapsed<std::chrono::microseconds>() / checks_,
+         "us");
+
+  /* Step4 */
+  bool consistent = true;
+  for (size_t n = 0; n < dimm_config_.GetSize(); ++n) {
+    if (ndctl_usc[n] != static_cast<long long>(pmem2_usc[n].usc)) {
+      std::cerr << "[ WARNING  ] USC mismatch for device "
+                << pmem2_usc[n].device_id << ": ndctl " << ndctl_usc[n]
+                << ", libpmem2 " << pmem2_usc[n].usc << std::endl;
+      consistent = false;
+    }
+  }
+  Report("usc_consistent", consistent ? "yes" : "no");
+}
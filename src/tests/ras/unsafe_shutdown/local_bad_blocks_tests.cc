@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "local_bad_blocks_tests.h"
+#include <fcntl.h>
+#include <unistd.h>
+
+std::ostream& operator<<(std::ostream& stream, bad_blocks_tc const& p) {
+  stream << p.description;
+  return stream;
+}
+
+void BadBlocksRepair::SetUp() {
+  ASSERT_TRUE(GetParam().enough_dimms)
+      << "Insufficient number of DIMMs to run this test";
+  create_on_pmem = true;
+  RecordProperty("pool_size", std::to_string(GetParam().pool_size));
+  RecordProperty("bad_blocks", std::to_string(GetParam().bad_blocks));
+  UnsafeShutdown::SetUp();
+}
+
+void BadBlocksRepair::TearDown() {
+  if (pop_) {
+    pmemobj_close(pop_);
+    pop_ = nullptr;
+  }
+  bad_blocks_.reset();
+  if (GetParam().enough_dimms) {
+    PoolsetManagement p_mgmt;
+    p_mgmt.RemovePartsFromPoolset(GetParam().poolset);
+    p_mgmt.RemovePoolsetFile(GetParam().poolset);
+  }
+}
+
+std::vector<bad_block> BadBlocksRepair::GetPlantedBlocks(const Part& part,
+                                                         size_t count) {
+  const uint64_t block = 4 * KIBIBYTE;
+  const uint64_t first = MEBIBYTE;
+  uint64_t stride = (part.GetSize() - first) / count / block * block;
+
+  std::vector<bad_block> blocks;
+  for (size_t i = 0; i < count; ++i) {
+    blocks.emplace_back(bad_block{first + i * stride, block});
+  }
+  return blocks;
+}
+
+int BadBlocksRepair::DamageHeader(const std::string& path) {
+  const std::vector<char> zeros(POOL_HDR_SIZE, 0);
+  int fd = open(path.c_str(), O_WRONLY);
+  if (fd == -1) {
+    return -1;
+  }
+  ssize_t written = pwrite(fd, zeros.data(), zeros.size(), 0);
+  close(fd);
+  return written == static_cast<ssize_t>(zeros.size()) ? 0 : -1;
+}
+
+/**
+ * TC_BAD_BLOCKS_REPAIR
+ * Create poolset with local replicas specified by parameter, plant bad blocks
+ * in the first part of secondary replica, repair them with pmempool_sync and
+ * measure repair time. Bad blocks are planted and repaired in one phase, as
+ * errors injected into nfit_test namespaces do not survive power cycle.
+ * \test
+ *          \li \c Step1. Create pool from poolset, write pattern to pool,
+ * close the pool / SUCCESS
+ *          \li \c Step2. Plant bad blocks in the first part of secondary
+ * replica; if they cannot be injected into namespace, discard their data and
+ * damage header of the part / SUCCESS
+ *          \li \c Step3. Sync pool with PMEMPOOL_SYNC_FIX_BAD_BLOCKS flag,
+ * measure repair time (part rebuild time if header was damaged), confirm bad
+ * blocks are cleared / SUCCESS
+ *          \li \c Step4. Open the pool, verify written pattern, close the pool
+ * / SUCCESS
+ *          \li \c Step5. Compare secondary replica with master replica,
+ * confirm planted blocks do not differ / SUCCESS
+ */
+TEST_P(BadBlocksRepair, TC_BAD_BLOCKS_REPAIR_phase_1) {
+  const Poolset& ps = GetParam().poolset;
+
+  /* Step1 */
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(ps))
+      << "error while creating poolset file";
+  pop_ = pmemobj_create(ps.GetFullPath().c_str(), nullptr, 0, 0644);
+  ASSERT_TRUE(pop_ != nullptr)
+      << "Error while creating the pool. Errno:" << errno << std::endl
+      << pmemobj_errormsg();
+  ObjData<int> pd{pop_};
+  ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
+  pmemobj_close(pop_);
+  pop_ = nullptr;
+
+  /* Step2 */
+  const Part& part = ps.GetReplica(1).GetPart(0);
+  planted_ = GetPlantedBlocks(part, GetParam().bad_blocks);
+  bad_blocks_.reset(new BadBlocks{part.GetPath()});
+  RecordProperty("bad_block_backend",
+                 BadBlocks::ToString(bad_blocks_->GetBackend()));
+  ASSERT_EQ(0, bad_blocks_->Plant(planted_)) << "Planting bad blocks failed";
+  /* time of rebuilding whole part does not depend on number of bad blocks */
+  std::string repair_name = "repair";
+  if (bad_blocks_->GetBackend() == BadBlockBackend::file) {
+    /* libpmempool cannot see blocks discarded from file, so the part is
+     * rebuilt as a whole */
+    std::cerr << "[ WARNING  ] Cannot inject errors under " << part.GetPath()
+              << ", whole part is repaired" << std::endl;
+    ASSERT_EQ(0, DamageHeader(part.GetPath()));
+    repair_name = "part_rebuild";
+  }
+
+  /* Step3 */
+  ASSERT_EQ(0, Timed(repair_name, [&ps] {
+              return pmempool_sync(ps.GetFullPath().c_str(),
+                                   PMEMPOOL_SYNC_FIX_BAD_BLOCKS);
+            })) << "Repairing bad blocks failed: "
+                << pmempool_errormsg();
+  ASSERT_EQ(0u, bad_blocks_->GetRemaining())
+      << "Bad blocks were not cleared by sync";
+
+  /* Step4 */
+  pop_ = pmemobj_open(ps.GetFullPath().c_str(), nullptr);
+  ASSERT_TRUE(pop_ != nullptr)
+      << "Pool could not be opened after repair. Errno: " << errno
+      << std::endl
+      << pmemobj_errormsg();
+  ObjData<int> repaired{pop_};
+  ASSERT_EQ(obj_data_, repaired.Read()) << "Reading data from pool failed";
+  pmemobj_close(pop_);
+  pop_ = nullptr;
+
+  /* Step5 */
+  MerkleTree master;
+  MerkleTree replica;
+  ASSERT_EQ(0, MerkleTree::Build(ps, 0, master));
+  ASSERT_EQ(0, MerkleTree::Build(ps, 1, replica));
+  /* pool offsets of the first part are equal to offsets in the part file */
+  for (const auto& range : master.Diff(replica)) {
+    for (const auto& block : planted_) {
+      ASSERT_FALSE(range.offset < block.offset + block.length &&
+                   block.offset < range.offset + range.length)
+          << "Repaired block at " << block.offset
+          << " differs from master replica: " << MerkleTree::ToString(range);
+    }
+  }
+}
+
+/*
+ * WithPrefix -- returns copy of given poolset with names of poolset file and
+ * parts prefixed with 'prefix'.
+ */
+static Poolset WithPrefix(const Poolset& ps, const std::string& prefix) {
+  auto prefixed = [&prefix](const std::string& path) {
+    size_t name = path.rfind('/') + 1;
+    return path.substr(0, name) + prefix + path.substr(name);
+  };
+
+  const std::string& path = ps.GetFullPath();
+  PoolsetBuilder builder{path.substr(0, path.size() - ps.GetName().size() - 1),
+                         prefix + ps.GetName()};
+  for (const auto& replica : ps.GetReplicas()) {
+    builder.AddReplica();
+    for (const auto& part : replica.GetParts()) {
+      builder.AddPart(part.GetSizeValue(), part.GetUnit(),
+                      prefixed(part.GetPath()));
+    }
+  }
+  return builder.Build();
+}
+
+std::vector<bad_blocks_tc> GetBadBlocksParams() {
+  std::vector<bad_blocks_tc> ret_vec;
+  for (const auto& layout : GetSyncLocalReplicaParams()) {
+    for (size_t count : {1, 8, 64}) {
+      bad_blocks_tc tc;
+      tc.description =
+          layout.description + ", bad blocks: " + std::to_string(count);
+      tc.enough_dimms = layout.enough_dimms;
+      tc.bad_blocks = count;
+      tc.pool_size = layout.pool_size;
+      if (tc.enough_dimms) {
+        tc.poolset =
+            WithPrefix(layout.poolset, "bb" + std::to_string(count) + "_");
+      }
+      ret_vec.emplace_back(tc);
+    }
+  }
+  return ret_vec;
+}
+
+INSTANTIATE_TEST_CASE_P(UnsafeShutdown, BadBlocksRepair,
+                        ::testing::ValuesIn(GetBadBlocksParams()));
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef US_LOCAL_BAD_BLOCKS_TESTS_H
+#define US_LOCAL_BAD_BLOCKS_TESTS_H
+
+#include <memory>
+#include "bad_blocks/bad_blocks.h"
+#include "local_replicas_tests.h"
+
+struct bad_blocks_tc {
+  std::string description;
+  Poolset poolset;
+  bool enough_dimms;
+  size_t bad_blocks;
+  size_t pool_size;
+};
+
+class BadBlocksRepair : public UnsafeShutdown,
+                        public ::testing::WithParamInterface<bad_blocks_tc> {
+ public:
+  std::unique_ptr<BadBlocks> bad_blocks_;
+  std::vector<bad_block> planted_;
+
+  void SetUp() override;
+  void TearDown() override;
+
+  /*
+   * GetPlantedBlocks -- returns 'count' 4 KiB blocks spread evenly over given
+   * part starting 1 MiB from its beginning, so that pool header and
+   * descriptor are not hit.
+   */
+  static std::vector<bad_block> GetPlantedBlocks(const Part& part,
+                                                 size_t count);
+
+  /*
+   * DamageHeader -- overwrites header of given part with zeros. Returns 0 on
+   * success, -1 otherwise.
+   */
+  static int DamageHeader(const std::string& path);
+};
+
+std::ostream& operator<<(std::ostream& stream, bad_blocks_tc const& p);
+
+/*
+ * GetBadBlocksParams -- returns layouts of SyncLocalReplica tests combined
+ * with growing number of bad blocks. Names of poolset files and parts are
+ * prefixed, so files of SyncLocalReplica tests are not reused.
+ */
+std::vector<bad_blocks_tc> GetBadBlocksParams();
+
+#endif  // US_LOCAL_BAD_BLOCKS_TESTS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2023, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -32,11 +32,50 @@
 
 #include "local_basic_tests.h"
 
+namespace {
+/*
+ * PlanPool -- returns pool created by phase 1 of basic test in first
+ * namespace from given list, sized by test parameter.
+ */
+std::vector<prestaged_pool> PlanPool(
+    const ::testing::TestInfo &test_info,
+    const std::vector<DimmNamespace> &namespaces) {
+  if (namespaces.empty() || test_info.value_param() == nullptr) {
+    return {};
+  }
+  for (const auto &size : LocalTestPhase::GetInstance().GetPoolSizes()) {
+    if (size.description == test_info.value_param()) {
+      return {{namespaces[0].GetTestDir() +
+                   UnsafeShutdown::GetNormalizedTestName(test_info) + "_pool",
+               size.size}};
+    }
+  }
+  return {};
+}
+
+std::vector<prestaged_pool> PlanUnsafeDimmPool(
+    const ::testing::TestInfo &test_info) {
+  return PlanPool(test_info,
+                  LocalTestPhase::GetInstance().GetUnsafeDimmNamespaces());
+}
+
+PoolPrestage::Registrar basic_prestage{"UnsafeShutdownBasic",
+                                       PlanUnsafeDimmPool};
+PoolPrestage::Registrar basic_clean_prestage{"UnsafeShutdownBasicClean",
+                                             PlanUnsafeDimmPool};
+PoolPrestage::Registrar basic_without_us_prestage{
+    "UnsafeShutdownBasicWithoutUS", [](const ::testing::TestInfo &test_info) {
+      return PlanPool(test_info,
+                      LocalTestPhase::GetInstance().GetSafeDimmNamespaces());
+    }};
+}
+
 void UnsafeShutdownBasic::SetUp() {
   ASSERT_LE(1, test_phase_.GetUnsafeDimmNamespaces().size())
       << "Insufficient number of dimms to run this test";
   us_dimm_pool_path_ = test_phase_.GetUnsafeDimmNamespaces()[0].GetTestDir() +
                        GetNormalizedTestName() + "_pool";
+  RecordProperty("pool_size", std::to_string(GetParam().size));
 }
 
 /**
@@ -51,10 +90,11 @@ void UnsafeShutdownBasic::SetUp() {
  *          \li \c Step6. Verify written pattern / SUCCESS
  *          \li \c Step7. Close the pool / SUCCESS
  */
-TEST_F(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_1) {
+TEST_P(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_1) {
   /* Step1 */
-  pop_ = pmemobj_create(us_dimm_pool_path_.c_str(), nullptr, PMEMOBJ_MIN_POOL,
-                        0644);
+  pop_ = Timed("create", [&] {
+    return CreatePool(us_dimm_pool_path_, GetParam().size);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
                                << std::endl
                                << pmemobj_errormsg();
@@ -66,7 +106,7 @@ TEST_F(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_1) {
 
 /* Step3. outside of test macros */
 
-TEST_F(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_2) {
+TEST_P(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_2) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 
   /* Step4 */
@@ -76,9 +116,12 @@ TEST_F(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_2) {
   ASSERT_EQ(EINVAL, errno);
 
   /* Step5 */
-  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED, PmempoolRepair(us_dimm_pool_path_))
-      << "Pool was not repaired";
-  pop_ = pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED, Timed("repair", [&] {
+              return PmempoolRepair(us_dimm_pool_path_);
+            })) << "Pool was not repaired";
+  pop_ = Timed("open", [&] {
+    return pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool opening failed. Errno: " << errno
                                << std::endl
                                << pmemobj_errormsg();
@@ -101,10 +144,11 @@ TEST_F(UnsafeShutdownBasic, TRY_OPEN_OBJ_phase_2) {
  *          \li \c Step5. Repair and open the pool / SUCCESS
  *          \li \c Step6. Verify pattern / SUCCESS
  */
-TEST_F(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_1) {
+TEST_P(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_1) {
   /* Step1 */
-  pop_ = pmemobj_create(us_dimm_pool_path_.c_str(), nullptr, PMEMOBJ_MIN_POOL,
-                        0644);
+  pop_ = Timed("create", [&] {
+    return CreatePool(us_dimm_pool_path_, GetParam().size);
+  });
   ASSERT_TRUE(pop_ != nullptr)
       << "Opening pool after shutdown failed. Errno: " << errno << std::endl
       << pmemobj_errormsg();
@@ -113,13 +157,13 @@ TEST_F(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_1) {
   ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
 }
 
-TEST_F(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_2) {
+TEST_P(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_2) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 }
 
 /* Step3. - outside of test macros */
 
-TEST_F(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_3) {
+TEST_P(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_3) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 
   /* step4 */
@@ -129,10 +173,12 @@ TEST_F(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_3) {
   ASSERT_EQ(EINVAL, errno);
 
   /* Step5 */
-  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED,
-            PmempoolRepair(us_dimm_pool_path_.c_str()))
-      << "Pool was not repaired";
-  pop_ = pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED, Timed("repair", [&] {
+              return PmempoolRepair(us_dimm_pool_path_);
+            })) << "Pool was not repaired";
+  pop_ = Timed("open", [&] {
+    return pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  });
   ASSERT_TRUE(pop_ != nullptr)
       << "Opening pool after shutdown failed. Errno: " << errno << std::endl
       << pmemobj_errormsg();
@@ -155,10 +201,11 @@ TEST_F(UnsafeShutdownBasic, TC_TRY_OPEN_AFTER_DOUBLE_US_phase_3) {
  *          \li \c Step6. Verify written pattern / SUCCESS
  *          \li \c Step7. Close the pool / SUCCESS
  */
-TEST_F(UnsafeShutdownBasicClean, TC_OPEN_CLEAN_phase_1) {
+TEST_P(UnsafeShutdownBasicClean, TC_OPEN_CLEAN_phase_1) {
   /* Step1 */
-  pop_ = pmemobj_create(us_dimm_pool_path_.c_str(), nullptr, PMEMOBJ_MIN_POOL,
-                        0644);
+  pop_ = Timed("create", [&] {
+    return CreatePool(us_dimm_pool_path_, GetParam().size);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
                                << std::endl
                                << pmemobj_errormsg();
@@ -169,11 +216,13 @@ TEST_F(UnsafeShutdownBasicClean, TC_OPEN_CLEAN_phase_1) {
 
 /* Step4. outside of test macros */
 
-TEST_F(UnsafeShutdownBasicClean, TC_OPEN_CLEAN_phase_2) {
+TEST_P(UnsafeShutdownBasicClean, TC_OPEN_CLEAN_phase_2) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 
   /* Step5 */
-  pop_ = pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  pop_ = Timed("open", [&] {
+    return pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  });
   ASSERT_TRUE(pop_ != nullptr) << pmemobj_errormsg() << "errno:" << errno;
 
   /* Step6 */
@@ -181,11 +230,20 @@ TEST_F(UnsafeShutdownBasicClean, TC_OPEN_CLEAN_phase_2) {
   ASSERT_EQ(obj_data_, pd.Read()) << "Data read from pool differs from written";
 }
 
+INSTANTIATE_TEST_CASE_P(
+    UnsafeShutdown, UnsafeShutdownBasic,
+    ::testing::ValuesIn(LocalTestPhase::GetInstance().GetPoolSizes()));
+
+INSTANTIATE_TEST_CASE_P(
+    UnsafeShutdown, UnsafeShutdownBasicClean,
+    ::testing::ValuesIn(LocalTestPhase::GetInstance().GetPoolSizes()));
+
 void UnsafeShutdownBasicWithoutUS::SetUp() {
   ASSERT_LE(1, test_phase_.GetSafeDimmNamespaces().size())
       << "Insufficient number of dimms to run this test";
   non_us_dimm_pool_path_ = test_phase_.GetSafeDimmNamespaces()[0].GetTestDir() +
                            GetNormalizedTestName() + "_pool";
+  RecordProperty("pool_size", std::to_string(GetParam().size));
 }
 
 /*
@@ -198,10 +256,11 @@ void UnsafeShutdownBasicWithoutUS::SetUp() {
 *          \li \c Step3. Open the pool / SUCCESS
 *          \li \c Step4. Verify pattern / SUCCESS
 */
-TEST_F(UnsafeShutdownBasicWithoutUS, TC_OPEN_DIRTY_NO_US_phase_1) {
+TEST_P(UnsafeShutdownBasicWithoutUS, TC_OPEN_DIRTY_NO_US_phase_1) {
   /* Step1 */
-  pop_ = pmemobj_create(non_us_dimm_pool_path_.c_str(), nullptr,
-                        PMEMOBJ_MIN_POOL, 0644);
+  pop_ = Timed("create", [&] {
+    return CreatePool(non_us_dimm_pool_path_, GetParam().size);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
                                << std::endl
                                << pmemobj_errormsg();
@@ -210,11 +269,13 @@ TEST_F(UnsafeShutdownBasicWithoutUS, TC_OPEN_DIRTY_NO_US_phase_1) {
   ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
 }
 
-TEST_F(UnsafeShutdownBasicWithoutUS, TC_OPEN_DIRTY_NO_US_phase_2) {
+TEST_P(UnsafeShutdownBasicWithoutUS, TC_OPEN_DIRTY_NO_US_phase_2) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 
   /* Step3 */
-  pop_ = pmemobj_open(non_us_dimm_pool_path_.c_str(), nullptr);
+  pop_ = Timed("open", [&] {
+    return pmemobj_open(non_us_dimm_pool_path_.c_str(), nullptr);
+  });
   ASSERT_TRUE(pop_ != nullptr)
       << "Opening pool after shutdown failed. Errno: " << errno << std::endl
       << pmemobj_errormsg();
@@ -223,3 +284,7 @@ TEST_F(UnsafeShutdownBasicWithoutUS, TC_OPEN_DIRTY_NO_US_phase_2) {
   ObjData<int> pd{pop_};
   ASSERT_EQ(obj_data_, pd.Read()) << "Data read from pool differs from written";
 }
+
+INSTANTIATE_TEST_CASE_P(
+    UnsafeShutdown, UnsafeShutdownBasicWithoutUS,
+    ::testing::ValuesIn(LocalTestPhase::GetInstance().GetPoolSizes()));
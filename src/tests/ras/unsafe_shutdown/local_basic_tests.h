@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2023, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -35,7 +35,9 @@
 
 #include "unsafe_shutdown.h"
 
-class UnsafeShutdownBasic : public UnsafeShutdown {
+class UnsafeShutdownBasic
+    : public UnsafeShutdown,
+      public ::testing::WithParamInterface<pool_size_param> {
  public:
   std::string us_dimm_pool_path_;
 
@@ -49,7 +51,9 @@ class UnsafeShutdownBasicClean : public UnsafeShutdownBasic {
   }
 };
 
-class UnsafeShutdownBasicWithoutUS : public UnsafeShutdown {
+class UnsafeShutdownBasicWithoutUS
+    : public UnsafeShutdown,
+      public ::testing::WithParamInterface<pool_size_param> {
  public:
   std::string non_us_dimm_pool_path_;
 
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local_huge_alloc_tests.h"
+#include "timer/timer.h"
+
+std::ostream& operator<<(std::ostream& stream, huge_alloc_param const& h) {
+  stream << h.description;
+  return stream;
+}
+
+std::vector<huge_alloc_param> GetHugeAllocParams() {
+  return {{"256KiB objects", 256 * KIBIBYTE, 64},
+          {"4MiB objects", 4 * MEBIBYTE, 16},
+          {"32MiB objects", 32 * MEBIBYTE, 4},
+          {"256MiB objects", 256 * MEBIBYTE, 2}};
+}
+
+void UnsafeShutdownHugeAlloc::SetUp() {
+  ASSERT_LE(1, test_phase_.GetUnsafeDimmNamespaces().size())
+      << "Insufficient number of dimms to run this test";
+  us_dimm_pool_path_ = test_phase_.GetUnsafeDimmNamespaces()[0].GetTestDir() +
+                       GetNormalizedTestName() + "_pool";
+  /* twice the data size leaves room for heap metadata and fragmentation */
+  pool_size_ = 2 * GetParam().obj_size * GetParam().obj_count +
+               PMEMOBJ_MIN_POOL;
+}
+
+/**
+ * TC_HUGE_ALLOC
+ * Create obj pool on DIMM, allocate, fill and free objects served by huge
+ * chunk allocator, trigger unsafe shutdown, try opening the pool
+ * \test
+ *          \li \c Step1. Create an obj pool on DIMM / SUCCESS
+ *          \li \c Step2. Allocate objects of size given by parameter and fill
+ * them with pattern, report allocation latency and fill bandwidth / SUCCESS
+ *          \li \c Step3. Free all objects, report free latency / SUCCESS
+ *          \li \c Step4. Allocate and fill objects again / SUCCESS
+ *          \li \c Step5. Trigger US, run power cycle, check USC values /
+ * SUCCESS
+ *          \li \c Step6. Open the pool / FAIL: pop = NULL, errno = EINVAL
+ *          \li \c Step7. Repair and open the pool / SUCCESS
+ *          \li \c Step8. Verify written pattern / SUCCESS
+ *          \li \c Step9. Free all objects and allocate them again / SUCCESS
+ */
+TEST_P(UnsafeShutdownHugeAlloc, TC_HUGE_ALLOC_phase_1) {
+  huge_alloc_param param = GetParam();
+
+  /* Step1 */
+  pop_ = CreatePool(us_dimm_pool_path_, pool_size_);
+  ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+
+  /* Step2 */
+  HugeObjData hd{pop_, param.obj_size};
+  Timer timer;
+  timer.Start();
+  ASSERT_EQ(0, hd.Alloc(param.obj_count)) << "Allocating objects failed";
+  timer.Stop();
+  RecordProperty("alloc_latency_us",
+                 std::to_string(timer.GetElapsed<std::chrono::microseconds>() /
+                                param.obj_count));
+
+  timer.Start();
+  size_t written = hd.Fill();
+  timer.Stop();
+  ASSERT_EQ(param.obj_size * param.obj_count, written);
+  RecordProperty(
+      "fill_bandwidth_MiBps",
+      std::to_string(static_cast<double>(written) / MEBIBYTE /
+                     timer.GetElapsed<std::chrono::duration<double>>()));
+
+  /* Step3 */
+  timer.Start();
+  ASSERT_EQ(param.obj_count, hd.Free());
+  timer.Stop();
+  RecordProperty("free_latency_us",
+                 std::to_string(timer.GetElapsed<std::chrono::microseconds>() /
+                                param.obj_count));
+
+  /* Step4 */
+  ASSERT_EQ(0, hd.Alloc(param.obj_count)) << "Allocating objects failed";
+  ASSERT_EQ(param.obj_size * param.obj_count, hd.Fill());
+}
+
+/* Step5. outside of test macros */
+
+TEST_P(UnsafeShutdownHugeAlloc, TC_HUGE_ALLOC_phase_2) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+  huge_alloc_param param = GetParam();
+
+  /* Step6 */
+  pop_ = pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  ASSERT_EQ(nullptr, pop_)
+      << "Pool was opened after unsafe shutdown but should be not";
+  ASSERT_EQ(EINVAL, errno);
+
+  /* Step7 */
+  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED, PmempoolRepair(us_dimm_pool_path_))
+      << "Pool was not repaired";
+  pop_ = pmemobj_open(us_dimm_pool_path_.c_str(), nullptr);
+  ASSERT_TRUE(pop_ != nullptr) << "Pool opening failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+
+  /* Step8 */
+  HugeObjData hd{pop_, param.obj_size};
+  ASSERT_EQ(0, hd.Verify(param.obj_count))
+      << "Data read from pool differs from written";
+
+  /* Step9 */
+  ASSERT_EQ(param.obj_count, hd.Free());
+  ASSERT_EQ(0, hd.Alloc(param.obj_count))
+      << "Allocating objects in repaired pool failed";
+}
+
+INSTANTIATE_TEST_CASE_P(UnsafeShutdown, UnsafeShutdownHugeAlloc,
+                        ::testing::ValuesIn(GetHugeAllocParams()));
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local_interrupted_sync_tests.h"
+#include <cstdlib>
+
+void SyncInterrupted::SetUp() {
+  const auto& unsafe_dn = test_phase_.GetUnsafeDimmNamespaces();
+  const auto& safe_dn = test_phase_.GetSafeDimmNamespaces();
+  ASSERT_LE(1, unsafe_dn.size())
+      << "Insufficient number of unsafely shutdown DIMMs to run this test";
+  ASSERT_LE(1, safe_dn.size())
+      << "Insufficient number of safely shutdown DIMMs to run this test";
+
+  const std::string size = std::to_string(GetParam().size);
+  replica_part_ = unsafe_dn[0].GetTestDir() + "sync_int_replica_" + size;
+  flight_path_ = replica_part_ + "_flight";
+  poolset_ = Poolset{
+      safe_dn[0].GetTestDir(),
+      "pool_sync_int_" + size + ".set",
+      {{"PMEMPOOLSET",
+        size + " " + safe_dn[0].GetTestDir() + "sync_int_master_" + size},
+       {"REPLICA", size + " " + replica_part_}}};
+
+  sync_marker_ = test_phase_.GetTestDir() + GetNormalizedTestName() +
+                 "_sync_done";
+  full_sync_path_ = test_phase_.GetTestDir() + GetNormalizedTestName() +
+                    "_full_sync_ms";
+  RecordProperty("pool_size", std::to_string(GetParam().size));
+  UnsafeShutdown::SetUp();
+}
+
+/**
+ * TC_SYNC_INTERRUPTED
+ * Create poolset with primary replica on safely shutdown DIMM and secondary
+ * replica on unsafely shutdown DIMM, break secondary replica, trigger US
+ * while pmempool_sync rebuilds it, measure time of resumed sync.
+ * \test
+ *          \li \c Step1. Create pool from poolset, write pattern to pool, close
+ * the pool / SUCCESS
+ *          \li \c Step2. Remove secondary replica part, measure time of full
+ * sync rebuilding it, remove the part again / SUCCESS
+ *          \li \c Step3. Trigger US, run power cycle, check USC values /
+ * SUCCESS
+ *          \li \c Step4. Start pmempool_sync in detached process logging its
+ * progress in flight recorder next to the secondary replica, wait for its
+ * first heartbeat / SUCCESS
+ *          \li \c Step5. Trigger US while sync is running, run power cycle,
+ * check USC values / SUCCESS
+ *          \li \c Step6. Print timeline of the sync decoded from flight
+ * recorder. If sync was interrupted, sync the pool, report sync time and its
+ * ratio to full sync time, else record the case as skipped / SUCCESS
+ *          \li \c Step7. Open the pool, verify written pattern / SUCCESS
+ */
+TEST_P(SyncInterrupted, TC_SYNC_INTERRUPTED_phase_1) {
+  /* Step1 */
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(poolset_))
+      << "Creating poolset file " << poolset_.GetFullPath() << " failed";
+  pop_ = pmemobj_create(poolset_.GetFullPath().c_str(), nullptr, 0, 0644);
+  ASSERT_TRUE(pop_ != nullptr)
+      << "Error while creating the pool. Errno: " << errno << std::endl
+      << pmemobj_errormsg();
+  ObjData<int> pd{pop_};
+  ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
+  pmemobj_close(pop_);
+  pop_ = nullptr;
+
+  /* Step2 */
+  ASSERT_EQ(0, ApiC::RemoveFile(replica_part_));
+  Timer timer;
+  timer.Start();
+  ASSERT_EQ(0, pmempool_sync(poolset_.GetFullPath().c_str(), 0))
+      << "Rebuilding replica failed";
+  timer.Stop();
+  RecordProperty("full_sync_ms", std::to_string(timer.GetElapsed()));
+  ASSERT_EQ(0, ApiC::CreateFileDurably(full_sync_path_,
+                                       std::to_string(timer.GetElapsed())));
+  ASSERT_EQ(0, ApiC::RemoveFile(replica_part_));
+}
+
+/* Step3 - outside of test macros */
+
+TEST_P(SyncInterrupted, TC_SYNC_INTERRUPTED_phase_2) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+
+  /* Step4 */
+  const std::string path = poolset_.GetFullPath();
+  DetachedOperation sync{sync_marker_};
+  sync.SetFlightRecorder(flight_path_);
+  ASSERT_EQ(0, sync.Start([path] { return pmempool_sync(path.c_str(), 0); }));
+
+  int exit_code;
+  bool running = sync.WaitForProgress(1000, exit_code);
+  if (!running) {
+    ASSERT_EQ(0, exit_code) << "pmempool_sync failed";
+  }
+  RecordProperty("sync_running_at_end", running ? "true" : "false");
+}
+
+/* Step5 - outside of test macros */
+
+TEST_P(SyncInterrupted, TC_SYNC_INTERRUPTED_phase_3) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+
+  /* Step6 */
+  std::vector<flight_event> timeline;
+  if (FlightRecorder::Decode(flight_path_, timeline) == 0) {
+    std::cout << "Sync timeline:" << std::endl
+              << FlightRecorder::FormatTimeline(timeline, 4);
+    if (!timeline.empty()) {
+      RecordProperty("flight_last_op",
+                     FlightRecorder::ToString(timeline.back().op));
+    }
+  }
+
+  double sync_ms = 0;
+  bool interrupted = !DetachedOperation{sync_marker_}.IsDone(sync_ms);
+  RecordProperty("sync_interrupted", interrupted ? "true" : "false");
+
+  const std::string path = poolset_.GetFullPath();
+  if (interrupted) {
+    Timer timer;
+    timer.Start();
+    int ret = pmempool_sync(path.c_str(), 0);
+    timer.Stop();
+    ASSERT_EQ(0, ret) << "Sync after interruption failed";
+    RecordProperty("resumed_sync_ms", std::to_string(timer.GetElapsed()));
+
+    std::string content;
+    if (ApiC::ReadFile(full_sync_path_, content) == 0) {
+      double full_sync_ms = std::atof(content.c_str());
+      if (full_sync_ms > 0) {
+        RecordProperty("resumed_to_full_sync_ratio",
+                       std::to_string(timer.GetElapsed() / full_sync_ms));
+      }
+    }
+  } else {
+    /* nothing to resume, only data of the pool is verified */
+    RecordProperty("skipped", "sync completed before unsafe shutdown");
+    std::cerr << "[ SKIPPED  ] Sync of " << path << " completed in "
+              << sync_ms << " ms before unsafe shutdown, use bigger pool size"
+              << std::endl;
+  }
+
+  /* Step7 */
+  pop_ = Timed("open", [&path] { return pmemobj_open(path.c_str(), nullptr); });
+  ASSERT_TRUE(pop_ != nullptr) << "Pool opening failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+  ObjData<int> pd{pop_};
+  ASSERT_EQ(obj_data_, pd.Read()) << "Data read from pool differs from written";
+}
+
+INSTANTIATE_TEST_CASE_P(
+    UnsafeShutdown, SyncInterrupted,
+    ::testing::ValuesIn(LocalTestPhase::GetInstance().GetPoolSizes()));
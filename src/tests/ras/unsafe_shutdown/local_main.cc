@@ -1,5 +1,5 @@
 /*
- * Copyright 2018, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -34,6 +34,10 @@
 #include "exit_codes.h"
 #include "gtest/gtest.h"
 #include "inject_manager/inject_manager.h"
+#include "pass_journal/pass_journal.h"
+#include "pool_prestage/pool_prestage.h"
+#include "pool_statistics/pool_statistics.h"
+#include "shard_runner/shard_runner.h"
 #include "shell/i_shell.h"
 #include "test_phase/local_test_phase.h"
 
@@ -42,6 +46,54 @@ bool PartiallyPassed() {
   return ut->successful_test_count() > 0 && ut->failed_test_count() > 0;
 }
 
+int RunTests(const LocalTestPhase &test_phase) {
+  const std::string phase_name = test_phase.GetPhaseName();
+  PassJournal &journal = PassJournal::GetInstance();
+  if (journal.Load(test_phase.GetTestDir()) != 0) {
+    return 1;
+  }
+  /* pools are prestaged by pre-test action of the first phase only */
+  if (test_phase.GetPhaseNumber() == 1 &&
+      PoolPrestage::GetInstance().Load(test_phase.GetTestDir()) != 0) {
+    return 1;
+  }
+
+  int ret = RUN_ALL_TESTS();
+  PoolPrestage &prestage = PoolPrestage::GetInstance();
+  prestage.RemoveTemplates();
+  if (prestage.GetRequests() > 0) {
+    std::cout << "Pool prestage: " << prestage.GetStatistics() << std::endl;
+  }
+  if (journal.Flush() != 0) {
+    std::cerr << "Saving test results to pass journal failed" << std::endl;
+    ret = 1;
+  }
+  if (PoolStatistics::GetInstance().Save(phase_name) != 0) {
+    std::cerr << "Saving pool statistics failed" << std::endl;
+  }
+  return ret;
+}
+
+int RunShards(unsigned workers, int argc, char **argv,
+              const std::string &phase_name) {
+  ShardRunner runner{workers, argc, argv};
+  int ret = runner.Run();
+  std::cout << "Workers: " << workers
+            << ", passed: " << runner.GetResult().successful
+            << ", failed: " << runner.GetResult().failed << std::endl;
+
+  std::vector<std::string> paths;
+  for (unsigned i = 0; i < runner.GetShards(); ++i) {
+    paths.emplace_back(PoolStatistics::GetOutputPath(
+        phase_name, runner.GetShardOutput(i)));
+  }
+  std::string output_path = PoolStatistics::GetOutputPath(phase_name);
+  if (PoolStatistics::Merge(paths, output_path) != 0) {
+    std::cerr << "Merging pool statistics failed" << std::endl;
+  }
+  return ret;
+}
+
 int main(int argc, char **argv) {
   int ret = 0;
   try {
@@ -49,12 +101,22 @@ int main(int argc, char **argv) {
     LocalTestPhase &test_phase = LocalTestPhase::GetInstance();
     test_phase.ParseCmdArgs(argc, argv);
 
+    /* Workers run their shard of tests only, filter is already modified and
+     * pre- and post-test actions are run by parent process */
+    if (ShardRunner::IsWorker()) {
+      ret = RunTests(test_phase);
+      return PartiallyPassed() ? exit_codes::partially_passed : ret;
+    }
+
     /* Modify --gtest_filter flag to run only tests from specific phase" */
     ::testing::GTEST_FLAG(filter) =
         "*" + test_phase.GetPhaseName() + "*" + ::testing::GTEST_FLAG(filter);
 
     if ((ret = test_phase.RunPreTestAction()) == 0) {
-      ret = RUN_ALL_TESTS();
+      unsigned workers = test_phase.GetWorkers();
+      ret = workers > 1
+                ? RunShards(workers, argc, argv, test_phase.GetPhaseName())
+                : RunTests(test_phase);
     }
     if (test_phase.RunPostTestAction() != 0) {
       return 1;
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local_many_pools_tests.h"
+#include <algorithm>
+#include <future>
+#include <thread>
+#include "mapping_info/mapping_info.h"
+#include "timer/timer.h"
+
+std::ostream& operator<<(std::ostream& stream, many_pools_param const& m) {
+  stream << m.description;
+  return stream;
+}
+
+std::vector<many_pools_param> GetManyPoolsParams() {
+  return {{"1 pool", 1},
+          {"16 pools", 16},
+          {"128 pools", 128},
+          {"256 pools", 256}};
+}
+
+void UnsafeShutdownManyPools::SetUp() {
+  const auto& unsafe_dn = test_phase_.GetUnsafeDimmNamespaces();
+  ASSERT_LE(1, unsafe_dn.size())
+      << "Insufficient number of dimms to run this test";
+
+  /* spread pools evenly across all unsafely shutdown DIMMs */
+  for (size_t i = 0; i < GetParam().pool_count; ++i) {
+    pool_paths_.emplace_back(unsafe_dn[i % unsafe_dn.size()].GetTestDir() +
+                             GetNormalizedTestName() + "_pool" +
+                             std::to_string(i));
+  }
+  pools_.resize(GetParam().pool_count, nullptr);
+  slowest_steps_.resize(GetParam().pool_count);
+}
+
+std::string UnsafeShutdownManyPools::RepairAndOpen(
+    const std::vector<size_t>& indexes) {
+  for (auto i : indexes) {
+    const std::string& path = pool_paths_[i];
+    pools_[i] = pmemobj_open(path.c_str(), nullptr);
+    if (pools_[i] != nullptr) {
+      return "Pool " + path +
+             " was opened after unsafe shutdown but should be not";
+    }
+    if (errno != EINVAL) {
+      return "Opening pool " + path + " failed with unexpected errno " +
+             std::to_string(errno);
+    }
+    if (PmempoolRepair(path, slowest_steps_[i]) !=
+        PMEMPOOL_CHECK_RESULT_REPAIRED) {
+      return "Pool " + path + " was not repaired";
+    }
+    pools_[i] = pmemobj_open(path.c_str(), nullptr);
+    if (pools_[i] == nullptr) {
+      return "Opening pool " + path + " after repair failed: " +
+             pmemobj_errormsg();
+    }
+  }
+  return "";
+}
+
+/**
+ * TC_MANY_POOLS
+ * Create and open many obj pools spread across DIMMs, trigger unsafe
+ * shutdown, repair and reopen all of them in parallel
+ * \test
+ *          \li \c Step1. Create obj pools on DIMMs, write pattern to each of
+ * them and close them / SUCCESS
+ *          \li \c Step2. Open all pools, report per-pool open latency, virtual
+ * address space and RSS overhead / SUCCESS
+ *          \li \c Step3. Trigger US, run power cycle, check USC values /
+ * SUCCESS
+ *          \li \c Step4. Open every pool / FAIL: pop = NULL, errno = EINVAL
+ *          \li \c Step5. Repair and open every pool, spreading pools across
+ * threads, report time of reopening all pools and the slowest repair step
+ * among all pools / SUCCESS
+ *          \li \c Step6. Verify pattern in every pool / SUCCESS
+ */
+TEST_P(UnsafeShutdownManyPools, TC_MANY_POOLS_phase_1) {
+  /* Step1 */
+  for (size_t i = 0; i < pool_paths_.size(); ++i) {
+    PMEMobjpool* pop = CreatePool(pool_paths_[i], PMEMOBJ_MIN_POOL);
+    ASSERT_TRUE(pop != nullptr) << "Creating pool " << pool_paths_[i]
+                                << " failed. Errno: " << errno << std::endl
+                                << pmemobj_errormsg();
+    ObjData<int> pd{pop};
+    int ret = pd.Write(obj_data_);
+    pmemobj_close(pop);
+    ASSERT_EQ(0, ret) << "Writing to pool failed";
+  }
+
+  /* Step2 */
+  process_memory before, after;
+  ASSERT_EQ(0, MappingInfo::ReadProcessMemory(before));
+
+  Timer timer;
+  double max_open_us = 0, total_open_us = 0;
+  for (size_t i = 0; i < pool_paths_.size(); ++i) {
+    timer.Start();
+    pools_[i] = pmemobj_open(pool_paths_[i].c_str(), nullptr);
+    timer.Stop();
+    ASSERT_TRUE(pools_[i] != nullptr) << "Opening pool " << pool_paths_[i]
+                                      << " failed. Errno: " << errno
+                                      << std::endl
+                                      << pmemobj_errormsg();
+    double open_us = timer.GetElapsed<std::chrono::microseconds>();
+    total_open_us += open_us;
+    max_open_us = std::max(max_open_us, open_us);
+  }
+
+  ASSERT_EQ(0, MappingInfo::ReadProcessMemory(after));
+  size_t count = pool_paths_.size();
+  RecordProperty("avg_open_latency_us", std::to_string(total_open_us / count));
+  RecordProperty("max_open_latency_us", std::to_string(max_open_us));
+  size_t vm_size_diff =
+      after.vm_size > before.vm_size ? after.vm_size - before.vm_size : 0;
+  size_t rss_diff = after.rss > before.rss ? after.rss - before.rss : 0;
+  RecordProperty("vm_size_per_pool_KiB",
+                 std::to_string(vm_size_diff / count / KIBIBYTE));
+  RecordProperty("rss_per_pool_KiB",
+                 std::to_string(rss_diff / count / KIBIBYTE));
+}
+
+/* Step3. outside of test macros */
+
+TEST_P(UnsafeShutdownManyPools, TC_MANY_POOLS_phase_2) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+
+  /* Step4, Step5 */
+  size_t workers = std::min<size_t>(
+      pool_paths_.size(), std::max(1U, std::thread::hardware_concurrency()));
+  std::vector<std::vector<size_t>> indexes(workers);
+  for (size_t i = 0; i < pool_paths_.size(); ++i) {
+    indexes[i % workers].emplace_back(i);
+  }
+
+  Timer timer;
+  timer.Start();
+  std::vector<std::future<std::string>> threads;
+  for (const auto& worker_indexes : indexes) {
+    threads.emplace_back(std::async(std::launch::async,
+                                    &UnsafeShutdownManyPools::RepairAndOpen,
+                                    this, worker_indexes));
+  }
+  std::vector<std::string> errors;
+  for (auto& t : threads) {
+    errors.emplace_back(t.get());
+  }
+  timer.Stop();
+
+  for (const auto& error : errors) {
+    ASSERT_TRUE(error.empty()) << error;
+  }
+  RecordProperty("reopen_all_ms", std::to_string(timer.GetElapsed()));
+  RecordProperty("reopen_threads", std::to_string(workers));
+  auto slowest = std::max_element(
+      slowest_steps_.begin(), slowest_steps_.end(),
+      [](const check_message& a, const check_message& b) {
+        return a.delta < b.delta;
+      });
+  if (!slowest->msg.empty()) {
+    size_t pool = static_cast<size_t>(slowest - slowest_steps_.begin());
+    RecordProperty("repair_slowest_step_ms",
+                   std::to_string(static_cast<long long>(slowest->delta)));
+    RecordProperty("repair_slowest_step", slowest->msg);
+    RecordProperty("repair_slowest_pool", pool_paths_[pool]);
+  }
+
+  /* Step6 */
+  for (auto pop : pools_) {
+    ObjData<int> pd{pop};
+    ASSERT_EQ(obj_data_, pd.Read())
+        << "Data read from pool differs from written";
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(UnsafeShutdown, UnsafeShutdownManyPools,
+                        ::testing::ValuesIn(GetManyPoolsParams()));
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef US_MANY_POOLS_TESTS_H
+#define US_MANY_POOLS_TESTS_H
+
+#include "unsafe_shutdown.h"
+
+struct many_pools_param {
+  std::string description;
+  size_t pool_count;
+};
+
+std::ostream& operator<<(std::ostream& stream, many_pools_param const& m);
+
+class UnsafeShutdownManyPools
+    : public UnsafeShutdown,
+      public ::testing::WithParamInterface<many_pools_param> {
+ public:
+  std::vector<std::string> pool_paths_;
+  std::vector<PMEMobjpool*> pools_;
+  /* the slowest check step of repair of every pool */
+  std::vector<check_message> slowest_steps_;
+
+  void SetUp() override;
+
+  ~UnsafeShutdownManyPools() {
+    if (close_pools_at_end_) {
+      for (auto pop : pools_) {
+        if (pop) {
+          pmemobj_close(pop);
+        }
+      }
+    }
+  }
+
+  /*
+   * RepairAndOpen -- opens pools with given indexes, expecting opening to fail
+   * because of unsafe shutdown, repairs and opens them again. Stores the
+   * slowest check step of each repair in slowest_steps_. Returns description
+   * of the first failure or empty string on success.
+   */
+  std::string RepairAndOpen(const std::vector<size_t>& indexes);
+};
+
+std::vector<many_pools_param> GetManyPoolsParams();
+
+#endif  // US_MANY_POOLS_TESTS_H
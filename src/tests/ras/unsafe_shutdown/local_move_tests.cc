@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2024, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -132,7 +132,7 @@ std::vector<move_param> GetMoveParams() {
     }
     ret_vec.emplace_back(tc);
   }
-  return ret_vec;
+  return WithPoolSizes(ret_vec);
 }
 
 void MovePoolClean::SetUp() {
@@ -143,6 +143,7 @@ void MovePoolClean::SetUp() {
   src_pool_path_ = param.src_pool_dir + GetNormalizedTestName() + "_pool";
   dest_pool_path_ = param.dest_pool_dir + GetNormalizedTestName() + "_pool";
   create_on_pmem = param.src_pool_dir_is_pmem;
+  RecordProperty("pool_size", std::to_string(param.pool_size));
   UnsafeShutdown::SetUp();
 }
 
@@ -164,7 +165,9 @@ void MovePoolClean::SetUp() {
  */
 TEST_P(MovePoolClean, TC_MOVE_POOL_CLEAN_phase_1) {
   /* Step1 */
-  pop_ = pmemobj_create(src_pool_path_.c_str(), nullptr, PMEMOBJ_MIN_POOL, 0644);
+  pop_ = Timed("create", [&] {
+    return CreatePool(src_pool_path_, GetParam().pool_size);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
                                << std::endl
                                << pmemobj_errormsg();
@@ -180,12 +183,16 @@ TEST_P(MovePoolClean, TC_MOVE_POOL_CLEAN_phase_2) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 
   /* Step4 */
-  auto out =
-      shell_.ExecuteCommand("mv " + src_pool_path_ + " " + dest_pool_path_);
+  auto out = Timed("move", [&] {
+    return shell_.ExecuteCommand("mv " + src_pool_path_ + " " +
+                                 dest_pool_path_);
+  });
   ASSERT_EQ(0, out.GetExitCode()) << out.GetContent() << std::endl;
 
   /* Step5 */
-  pop_ = pmemobj_open(dest_pool_path_.c_str(), nullptr);
+  pop_ = Timed("open", [&] {
+    return pmemobj_open(dest_pool_path_.c_str(), nullptr);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool opening failed. Errno:" << errno
                                << std::endl
                                << pmemobj_errormsg();
@@ -205,6 +212,7 @@ void MovePoolDirty::SetUp() {
   src_pool_path_ = param.src_pool_dir + GetNormalizedTestName() + "_pool";
   dest_pool_path_ = param.dest_pool_dir + GetNormalizedTestName() + "_pool";
   create_on_pmem = param.src_pool_dir_is_pmem;
+  RecordProperty("pool_size", std::to_string(param.pool_size));
   UnsafeShutdown::SetUp();
 }
 
@@ -226,7 +234,9 @@ void MovePoolDirty::SetUp() {
  */
 TEST_P(MovePoolDirty, TC_MOVE_POOL_DIRTY_phase_1) {
   /* Step1 */
-  pop_ = pmemobj_create(src_pool_path_.c_str(), nullptr, PMEMOBJ_MIN_POOL, 0644);
+  pop_ = Timed("create", [&] {
+    return CreatePool(src_pool_path_, GetParam().pool_size);
+  });
   ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed" << std::endl
                                << pmemobj_errormsg();
 
@@ -241,8 +251,10 @@ TEST_P(MovePoolDirty, TC_MOVE_POOL_DIRTY_phase_2) {
   ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
 
   /* Step4 */
-  auto out =
-      shell_.ExecuteCommand("mv " + src_pool_path_ + " " + dest_pool_path_);
+  auto out = Timed("move", [&] {
+    return shell_.ExecuteCommand("mv " + src_pool_path_ + " " +
+                                 dest_pool_path_);
+  });
   ASSERT_EQ(0, out.GetExitCode()) << "Moving operation failed" << std::endl
                                   << out.GetContent() << std::endl;
 
@@ -253,9 +265,12 @@ TEST_P(MovePoolDirty, TC_MOVE_POOL_DIRTY_phase_2) {
   ASSERT_EQ(EINVAL, errno);
 
   /* Step6 */
-  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED, PmempoolRepair(dest_pool_path_))
-      << "Pool was not repaired";
-  pop_ = pmemobj_open(dest_pool_path_.c_str(), nullptr);
+  ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED, Timed("repair", [&] {
+              return PmempoolRepair(dest_pool_path_);
+            })) << "Pool was not repaired";
+  pop_ = Timed("open", [&] {
+    return pmemobj_open(dest_pool_path_.c_str(), nullptr);
+  });
   ASSERT_TRUE(pop_ != nullptr)
       << "Pool after repair was not opened. Errno: " << errno << std::endl
       << pmemobj_errormsg();
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2024, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -41,6 +41,7 @@ struct move_param {
   std::string dest_pool_dir;
   bool enough_dimms;
   bool src_pool_dir_is_pmem;
+  size_t pool_size;
 };
 
 std::ostream& operator<<(std::ostream& stream, move_param const& m);
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local_poolset_options_tests.h"
+#include <algorithm>
+#include "poolset/poolset_builder.h"
+
+std::ostream& operator<<(std::ostream& stream, poolset_option_tc const& p) {
+  stream << p.description;
+  return stream;
+}
+
+void PoolsetOptionsRecovery::SetUp() {
+  const auto& unsafe_dn = test_phase_.GetUnsafeDimmNamespaces();
+  const auto& safe_dn = test_phase_.GetSafeDimmNamespaces();
+  ASSERT_LE(1, unsafe_dn.size())
+      << "Insufficient number of unsafely shutdown DIMMs to run this test";
+  ASSERT_LE(1, safe_dn.size())
+      << "Insufficient number of safely shutdown DIMMs to run this test";
+
+  const poolset_option_tc& param = GetParam();
+  const std::string name = "pool_options_" + GetNormalizedTestName();
+  const std::string master = unsafe_dn[0].GetTestDir() + name + "_master";
+  const std::string replica = safe_dn[0].GetTestDir() + name + "_replica";
+  PoolsetBuilder builder{safe_dn[0].GetTestDir(), name + ".set"};
+  for (const auto option : param.options) {
+    builder.AddOption(option);
+  }
+
+  if (param.directories) {
+    poolset_ = builder.AddReplica()
+                   .AddDirectoryPart(pool_size_ / MEBIBYTE, SizeUnit::mib,
+                                     master)
+                   .AddReplica()
+                   .AddDirectoryPart(pool_size_ / MEBIBYTE, SizeUnit::mib,
+                                     replica)
+                   .Build();
+  } else {
+    const size_t part_size = pool_size_ / parts_ / MEBIBYTE;
+    poolset_ = builder.AddReplica()
+                   .AddParts(parts_, part_size, SizeUnit::mib,
+                             {unsafe_dn[0].GetTestDir()}, name + "_master")
+                   .AddReplica()
+                   .AddParts(parts_, part_size, SizeUnit::mib,
+                             {safe_dn[0].GetTestDir()}, name + "_replica")
+                   .Build();
+  }
+
+  RecordProperty("parts", std::to_string(poolset_.GetParts().size()));
+  UnsafeShutdown::SetUp();
+}
+
+bool PoolsetOptionsRecovery::HasNohdrs() const {
+  const auto& options = GetParam().options;
+  return std::find(options.begin(), options.end(), PoolsetOption::nohdrs) !=
+         options.end();
+}
+
+bool PoolsetOptionsRecovery::IsUnsupported() const {
+  PoolsetManagement p_mgmt;
+  return HasNohdrs() && !p_mgmt.PoolsetFileExists(poolset_);
+}
+
+/**
+ * TC_POOLSET_OPTIONS_RECOVERY
+ * Create poolset with master replica on unsafely shutdown DIMM and secondary
+ * replica on safely shutdown DIMM, each with many parts, option or directory
+ * parts given by parameter, trigger US and recover the pool.
+ * \test
+ *          \li \c Step1. Create poolset file, create directories of directory
+ * parts / SUCCESS
+ *          \li \c Step2. Create pool from the poolset, write pattern to the
+ * pool / SUCCESS, pool with NOHDRS option is reported as unsupported if
+ * libpmemobj does not accept it
+ *          \li \c Step3. Trigger US, run power cycle, check USC values /
+ * SUCCESS
+ *          \li \c Step4. Open the pool / FAILURE: pop = NULL, errno = EINVAL
+ *          \li \c Step5. Sync the pool, open it, verify written pattern,
+ * report recovery time / SUCCESS
+ */
+TEST_P(PoolsetOptionsRecovery, TC_POOLSET_OPTIONS_RECOVERY_phase_1) {
+  /* Step1 */
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(poolset_))
+      << "Creating poolset file " << poolset_.GetFullPath() << " failed";
+  for (const auto& part : poolset_.GetParts()) {
+    if (part.IsDirectory()) {
+      ASSERT_EQ(0, ApiC::CreateDirectoryT(part.GetPath()));
+    }
+  }
+
+  /* Step2 */
+  pop_ = Timed("create", [this] {
+    return pmemobj_create(poolset_.GetFullPath().c_str(), nullptr, 0, 0644);
+  });
+  if (pop_ == nullptr && HasNohdrs()) {
+    std::cerr << "[ WARNING  ] NOHDRS option is not supported: "
+              << pmemobj_errormsg() << std::endl;
+    RecordProperty("supported", "false");
+    ASSERT_EQ(0, p_mgmt.RemovePoolsetFile(poolset_));
+    return;
+  }
+  ASSERT_TRUE(pop_ != nullptr)
+      << "Error while creating the pool. Errno: " << errno << std::endl
+      << pmemobj_errormsg();
+  ObjData<int> pd{pop_};
+  ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
+}
+
+/* Step3 - outside of test macros */
+
+TEST_P(PoolsetOptionsRecovery, TC_POOLSET_OPTIONS_RECOVERY_phase_2) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+  if (IsUnsupported()) {
+    RecordProperty("supported", "false");
+    return;
+  }
+
+  /* Step4 */
+  const std::string path = poolset_.GetFullPath();
+  Timer timer;
+  timer.Start();
+  pop_ = Timed("failed_open",
+               [&path] { return pmemobj_open(path.c_str(), nullptr); });
+  ASSERT_EQ(nullptr, pop_)
+      << "Pool after unsafely shutdown was opened but should be not";
+  ASSERT_EQ(EINVAL, errno);
+
+  /* Step5 */
+  ASSERT_EQ(0, Timed("sync", [&path] {
+              return pmempool_sync(path.c_str(), 0);
+            })) << "Syncing pool failed";
+  pop_ = Timed("open", [&path] { return pmemobj_open(path.c_str(), nullptr); });
+  ASSERT_TRUE(pop_ != nullptr) << "Pool could not be opened after sync";
+  ObjData<int> pd{pop_};
+  ASSERT_EQ(obj_data_, pd.Read()) << "Reading data from pool failed";
+  timer.Stop();
+  RecordProperty("recovery_ms", std::to_string(timer.GetElapsed()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    UnsafeShutdown, PoolsetOptionsRecovery,
+    ::testing::Values(
+        poolset_option_tc{"16 parts", {}, false},
+        poolset_option_tc{"16 parts, OPTION SINGLEHDR",
+                          {PoolsetOption::singlehdr},
+                          false},
+        poolset_option_tc{"16 parts, OPTION NOHDRS", {PoolsetOption::nohdrs},
+                          false},
+        poolset_option_tc{"directory parts", {}, true}));
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef US_LOCAL_POOLSET_OPTIONS_TESTS_H
+#define US_LOCAL_POOLSET_OPTIONS_TESTS_H
+
+#include "unsafe_shutdown.h"
+
+struct poolset_option_tc {
+  std::string description;
+  std::vector<PoolsetOption> options;
+  bool directories;
+};
+
+std::ostream& operator<<(std::ostream& stream, poolset_option_tc const& p);
+
+class PoolsetOptionsRecovery
+    : public UnsafeShutdown,
+      public ::testing::WithParamInterface<poolset_option_tc> {
+ public:
+  const size_t pool_size_ = 64 * MEBIBYTE;
+  const size_t parts_ = 16;
+  Poolset poolset_;
+
+  void SetUp() override;
+  bool HasNohdrs() const;
+
+  /*
+   * IsUnsupported -- returns true if the pool with NOHDRS option was not
+   * created in the first phase because libpmemobj does not support it. Pool
+   * set file is removed in such case.
+   */
+  bool IsUnsupported() const;
+};
+
+#endif  // US_LOCAL_POOLSET_OPTIONS_TESTS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2024, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -42,9 +42,31 @@ void SyncLocalReplica::SetUp() {
   ASSERT_TRUE(param.enough_dimms)
       << "Insufficient number of DIMMs to run this test";
   create_on_pmem = true;
+  RecordProperty("pool_size", std::to_string(param.pool_size));
   UnsafeShutdown::SetUp();
 }
 
+const uint64_t SyncLocalReplica::POOL_DESCRIPTOR_SIZE;
+
+uint64_t SyncLocalReplica::ReportDiff(const std::string& name,
+                                      const MerkleTree& tree,
+                                      const MerkleTree& other) {
+  std::vector<diff_range> ranges = tree.Diff(other);
+  uint64_t past_descriptor = 0;
+  for (const auto& range : ranges) {
+    std::cout << "[ DIFF     ] " << name << ": " << MerkleTree::ToString(range)
+              << std::endl;
+    uint64_t begin = std::max(range.offset, POOL_DESCRIPTOR_SIZE);
+    uint64_t end = range.offset + range.length;
+    if (end > begin) {
+      past_descriptor += end - begin;
+    }
+  }
+  RecordProperty(name + "_bytes",
+                 std::to_string(MerkleTree::GetDiffSize(ranges)));
+  return past_descriptor;
+}
+
 /**
  * TC_SYNC_LOCAL_REPLICA
  * Create poolset with local replicas specified by parameter write data,
@@ -52,9 +74,10 @@ void SyncLocalReplica::SetUp() {
  * If syncable: restore pool from replica and confirm written data correctness
  * else: repair, sync, confirm written data.
  * \test
- *          \li \c Step1. Create a pool from poolset with primary pool on unsafely shutdown DIMM
+ *          \li \c Step1. Preallocate parts and create a pool from poolset with primary pool on unsafely shutdown DIMM
  * and replicas according to given parameter. / SUCCESS
- *          \li \c Step2. Write pattern to pool persistently.
+ *          \li \c Step2. Write pattern to pool persistently, save Merkle tree
+ * of master replica as snapshot / SUCCESS
  *          \li \c Step3. Trigger unsafely shutdown on specified dimms, power cycle,
  *          confirm USC is incremented / SUCCESS
  *          \li \c Step4. Open the pool / FAIL: pop = NULL, errno = EINVAL
@@ -62,6 +85,9 @@ void SyncLocalReplica::SetUp() {
  *          \li \c Step6. Open the pool / SUCCESS
  *          \li \c Step7. Read and confirm data from pool / SUCCESS
  *          \li \c Step8. Close the pool / SUCCESS
+ *          \li \c Step9. Compare every replica and the snapshot with master
+ * replica, report differing ranges, confirm replicas do not differ past pool
+ * descriptor / SUCCESS
  */
 TEST_P(SyncLocalReplica, TC_SYNC_LOCAL_REPLICA_phase_1) {
   Poolset ps = GetParam().poolset;
@@ -73,7 +99,23 @@ TEST_P(SyncLocalReplica, TC_SYNC_LOCAL_REPLICA_phase_1) {
   ASSERT_TRUE(p_mgmt.PoolsetFileExists(ps))
       << "Poolset file " << ps.GetFullPath() << " does not exist";
 
-  pop_ = pmemobj_create(ps.GetFullPath().c_str(), nullptr, 0, 0644);
+  std::vector<part_preallocation> stats;
+  ASSERT_EQ(0, Timed("preallocate", [&] {
+              return p_mgmt.PreallocateParts(ps, stats);
+            })) << "Preallocating parts failed";
+  double min_bandwidth = 0;
+  for (const auto& part : stats) {
+    std::cout << "[ PREALLOC ] " << part.path << ": " << part.GetBandwidth()
+              << " MiB/s" << std::endl;
+    if (min_bandwidth == 0 || part.GetBandwidth() < min_bandwidth) {
+      min_bandwidth = part.GetBandwidth();
+    }
+  }
+  RecordProperty("preallocate_min_mib_per_s", std::to_string(min_bandwidth));
+
+  pop_ = Timed("create", [&] {
+    return pmemobj_create(ps.GetFullPath().c_str(), nullptr, 0, 0644);
+  });
   ASSERT_TRUE(pop_ != nullptr)
       << "Error while creating the pool. Errno:" << errno << std::endl
       << pmemobj_errormsg();
@@ -81,6 +123,11 @@ TEST_P(SyncLocalReplica, TC_SYNC_LOCAL_REPLICA_phase_1) {
   /* Step2 */
   ObjData<int> pd{pop_};
   ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
+  MerkleTree snapshot;
+  ASSERT_EQ(0, Timed("snapshot", [&] {
+              return MerkleTree::Build(ps, 0, snapshot);
+            })) << "Hashing master replica failed";
+  ASSERT_EQ(0, snapshot.Save(GetSnapshotPath()));
 }
 
 /* Step3 - outside of test macros */
@@ -98,20 +145,26 @@ TEST_P(SyncLocalReplica, TC_SYNC_LOCAL_REPLICA_phase_2) {
 
   /* Step5 */
   int expected_sync_exit = (param.is_syncable ? 0 : -1);
-  ASSERT_EQ(pmempool_sync(param.poolset.GetFullPath().c_str(), 0),
+  auto sync = [&param] {
+    return pmempool_sync(param.poolset.GetFullPath().c_str(), 0);
+  };
+  auto open = [&param] {
+    return pmemobj_open(param.poolset.GetFullPath().c_str(), nullptr);
+  };
+  ASSERT_EQ(Timed(param.is_syncable ? "sync" : "failed_sync", sync),
             expected_sync_exit);
-  pop_ = pmemobj_open(param.poolset.GetFullPath().c_str(), nullptr);
+  pop_ = Timed(param.is_syncable ? "open" : "failed_open", open);
 
   if (!param.is_syncable) {
     ASSERT_EQ(nullptr, pop_)
         << "Pool was unexpectedly opened after failed sync";
     ASSERT_EQ(EINVAL, errno);
-    ASSERT_EQ(PMEMPOOL_CHECK_RESULT_SYNC_REQ,
-              PmempoolRepair(param.poolset.GetFullPath()))
-        << "Pool was not repaired";
-    ASSERT_EQ(pmempool_sync(param.poolset.GetFullPath().c_str(), 0), 0);
+    ASSERT_EQ(PMEMPOOL_CHECK_RESULT_SYNC_REQ, Timed("repair", [&param, this] {
+                return PmempoolRepair(param.poolset.GetFullPath());
+              })) << "Pool was not repaired";
+    ASSERT_EQ(Timed("sync", sync), 0);
 
-    pop_ = pmemobj_open(param.poolset.GetFullPath().c_str(), nullptr);
+    pop_ = Timed("open", open);
   }
 
   /* Step6 */
@@ -121,14 +174,74 @@ TEST_P(SyncLocalReplica, TC_SYNC_LOCAL_REPLICA_phase_2) {
   /* Step7 */
   ObjData<int> pd{pop_};
   ASSERT_EQ(obj_data_, pd.Read()) << "Reading data from pool failed";
+
+  /* Step8 */
+  pmemobj_close(pop_);
+  pop_ = nullptr;
+
+  /* Step9 */
+  std::vector<MerkleTree> trees(param.poolset.GetReplicas().size());
+  ASSERT_EQ(0, Timed("replica_diff", [&] {
+              int ret = 0;
+              for (unsigned i = 0; i < trees.size(); ++i) {
+                ret |= MerkleTree::Build(param.poolset, i, trees[i]);
+              }
+              return ret;
+            })) << "Hashing replicas failed";
+  for (size_t i = 1; i < trees.size(); ++i) {
+    ASSERT_EQ(0u, ReportDiff("replica_" + std::to_string(i) + "_diff",
+                             trees[0], trees[i]))
+        << "Replica " << i << " differs from master replica";
+  }
+
+  MerkleTree snapshot;
+  ASSERT_EQ(0, MerkleTree::Load(GetSnapshotPath(), snapshot));
+  ReportDiff("snapshot_diff", snapshot, trees[0]);
+  ApiC::RemoveFile(GetSnapshotPath());
 }
 
-std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
+/*
+ * GetPartSize -- returns size in bytes of part holding 'count' of 'shares'
+ * equal shares of replica of given nominal pool size. Shares are rounded up
+ * to part header size and every part gets room for its own header, so that
+ * usable size of the replica is not smaller than the nominal pool size. Part
+ * is never smaller than PMEMOBJ_MIN_PART.
+ */
+static size_t GetPartSize(size_t pool_size, size_t shares, size_t count = 1) {
+  const size_t header = POOL_HDR_SIZE;
+  size_t share = (pool_size + shares - 1) / shares;
+  share = (share + header - 1) / header * header;
+  return std::max(count * share + header, PMEMOBJ_MIN_PART);
+}
+
+/*
+ * GetSyncLocalReplicaParams -- returns test cases with pool of given size.
+ * Nominal pool size is divided between parts of every replica, names of
+ * poolset files and parts are suffixed with pool size.
+ */
+static std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams(
+    const pool_size_param& size) {
   LocalTestPhase& test_phase = LocalTestPhase::GetInstance();
   const auto& unsafe_dn = test_phase.GetUnsafeDimmNamespaces();
   const auto& safe_dn = test_phase.GetSafeDimmNamespaces();
 
   std::vector<sync_local_replica_tc> ret_vec;
+  const std::string sfx = "_" + std::to_string(size.size);
+  /* two equal parts of replica */
+  auto half_part = [&](const std::string& dir, const std::string& name) {
+    return Part{GetPartSize(size.size, 2) / KIBIBYTE, SizeUnit::kib,
+                dir + name + sfx};
+  };
+  /* one of three equal parts of replica */
+  auto part = [&](const std::string& dir, const std::string& name) {
+    return Part{GetPartSize(size.size, 3) / KIBIBYTE, SizeUnit::kib,
+                dir + name + sfx};
+  };
+  /* part taking two thirds of replica */
+  auto double_part = [&](const std::string& dir, const std::string& name) {
+    return Part{GetPartSize(size.size, 3, 2) / KIBIBYTE, SizeUnit::kib,
+                dir + name + sfx};
+  };
 
   /* Master replica on unsafely shutdown DIMM, healthy secondary replica on
    * another DIMM. */
@@ -139,14 +252,15 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "on safely shutdown DIMM.";
     if (unsafe_dn.size() > 0 && safe_dn.size() > 0) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          safe_dn[0].GetTestDir(),
-          "pool_tc1.set",
-          {{"PMEMPOOLSET",
-            "9MB " + unsafe_dn[0].GetTestDir() + "tc1_master.part0",
-            "9MB " + safe_dn[0].GetTestDir() + "tc1_master.part1"},
-           {"REPLICA", "9MB " + safe_dn[0].GetTestDir() + "tc1_replica.part0",
-            "9MB " + safe_dn[0].GetTestDir() + "tc1_replica.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{safe_dn[0].GetTestDir(), "pool_tc1" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(half_part(unsafe_dn[0].GetTestDir(), "tc1_master.part0"))
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc1_master.part1"))
+              .AddReplica()
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc1_replica.part0"))
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc1_replica.part1"))
+              .Build();
       tc.is_syncable = true;
     } else {
       tc.enough_dimms = false;
@@ -168,17 +282,19 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "on unsafely shutdown DIMM ";
     if (unsafe_dn.size() > 0 && safe_dn.size() > 0) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          safe_dn[0].GetTestDir(),
-          "pool_tc3.set",
-          {{"PMEMPOOLSET",
-            "9MB " + unsafe_dn[0].GetTestDir() + "tc3_master.part0",
-            "9MB " + safe_dn[0].GetTestDir() + "tc3_master.part1"},
-           {"REPLICA",
-            "9MB " + unsafe_dn[0].GetTestDir() + "tc3_replica1.part0",
-            "9MB " + safe_dn[0].GetTestDir() + "tc3_replica1.part1"},
-           {"REPLICA", "9MB " + safe_dn[0].GetTestDir() + "tc3_replica2.part0",
-            "9MB " + safe_dn[0].GetTestDir() + "tc3_replica2.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{safe_dn[0].GetTestDir(), "pool_tc3" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(half_part(unsafe_dn[0].GetTestDir(), "tc3_master.part0"))
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc3_master.part1"))
+              .AddReplica()
+              .AddPart(
+                  half_part(unsafe_dn[0].GetTestDir(), "tc3_replica1.part0"))
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc3_replica1.part1"))
+              .AddReplica()
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc3_replica2.part0"))
+              .AddPart(half_part(safe_dn[0].GetTestDir(), "tc3_replica2.part1"))
+              .Build();
       tc.is_syncable = true;
     } else {
       tc.enough_dimms = false;
@@ -193,14 +309,16 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "Master and secondary replicas on same unsafely shutdown DIMM.";
     if (unsafe_dn.size() > 0) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          unsafe_dn[0].GetTestDir(),
-          "pool1.set",
-          {{"PMEMPOOLSET", "9MB " + unsafe_dn[0].GetTestDir() + "master1.part0",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master1.part1",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master1.part2"},
-           {"REPLICA", "9MB " + unsafe_dn[0].GetTestDir() + "replica1.part0",
-            "18MB " + unsafe_dn[0].GetTestDir() + "replica1.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{unsafe_dn[0].GetTestDir(), "pool1" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master1.part0"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master1.part1"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master1.part2"))
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "replica1.part0"))
+              .AddPart(double_part(unsafe_dn[0].GetTestDir(), "replica1.part1"))
+              .Build();
       tc.is_syncable = false;
     } else {
       tc.enough_dimms = false;
@@ -217,13 +335,15 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "safely shutdown DIMMs.";
     if (unsafe_dn.size() > 0 && safe_dn.size() > 0) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          unsafe_dn[0].GetTestDir(),
-          "pool2.set",
-          {{"PMEMPOOLSET", "9MB " + unsafe_dn[0].GetTestDir() + "master2.part0",
-            "9MB " + safe_dn[0].GetTestDir() + "master2.part1"},
-           {"REPLICA", "9MB " + safe_dn[0].GetTestDir() + "replica2.part0",
-            "18MB " + unsafe_dn[0].GetTestDir() + "replica2.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{unsafe_dn[0].GetTestDir(), "pool2" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master2.part0"))
+              .AddPart(part(safe_dn[0].GetTestDir(), "master2.part1"))
+              .AddReplica()
+              .AddPart(part(safe_dn[0].GetTestDir(), "replica2.part0"))
+              .AddPart(double_part(unsafe_dn[0].GetTestDir(), "replica2.part1"))
+              .Build();
       tc.is_syncable = false;
     } else {
       tc.enough_dimms = false;
@@ -239,14 +359,16 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "Master and secondary replica on different unsafely shutdown DIMMs.";
     if (unsafe_dn.size() > 1) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          unsafe_dn[0].GetTestDir(),
-          "pool3.set",
-          {{"PMEMPOOLSET", "9MB " + unsafe_dn[0].GetTestDir() + "master3.part0",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master3.part1",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master3.part2"},
-           {"REPLICA", "9MB " + unsafe_dn[1].GetTestDir() + "replica3.part0",
-            "18MB " + unsafe_dn[1].GetTestDir() + "replica3.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{unsafe_dn[0].GetTestDir(), "pool3" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master3.part0"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master3.part1"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master3.part2"))
+              .AddReplica()
+              .AddPart(part(unsafe_dn[1].GetTestDir(), "replica3.part0"))
+              .AddPart(double_part(unsafe_dn[1].GetTestDir(), "replica3.part1"))
+              .Build();
       tc.is_syncable = false;
     } else {
       tc.enough_dimms = false;
@@ -264,14 +386,16 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "dimms.";
     if (unsafe_dn.size() >= 2) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          unsafe_dn[0].GetTestDir(),
-          "pool4.set",
-          {{"PMEMPOOLSET", "9MB " + unsafe_dn[0].GetTestDir() + "master4.part0",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master4.part1",
-            "9MB " + unsafe_dn[1].GetTestDir() + "master4.part2"},
-           {"REPLICA", "9MB " + unsafe_dn[1].GetTestDir() + "replica4.part0",
-            "18MB " + unsafe_dn[0].GetTestDir() + "replica4.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{unsafe_dn[0].GetTestDir(), "pool4" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master4.part0"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master4.part1"))
+              .AddPart(part(unsafe_dn[1].GetTestDir(), "master4.part2"))
+              .AddReplica()
+              .AddPart(part(unsafe_dn[1].GetTestDir(), "replica4.part0"))
+              .AddPart(double_part(unsafe_dn[0].GetTestDir(), "replica4.part1"))
+              .Build();
       tc.is_syncable = false;
     } else {
       tc.enough_dimms = false;
@@ -292,16 +416,21 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
         "2";
     if (unsafe_dn.size() >= 2) {
       tc.enough_dimms = true;
-      tc.poolset = Poolset{
-          unsafe_dn[0].GetTestDir(),
-          "pool6.set",
-          {{"PMEMPOOLSET", "9MB " + unsafe_dn[0].GetTestDir() + "master6.part0",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master6.part1",
-            "9MB " + unsafe_dn[0].GetTestDir() + "master6.part2"},
-           {"REPLICA", "9MB " + unsafe_dn[1].GetTestDir() + "replica6a.part0",
-            "18MB " + unsafe_dn[1].GetTestDir() + "replica6a.part1"},
-           {"REPLICA", "9MB " + unsafe_dn[0].GetTestDir() + "replica6b.part0",
-            "18MB " + unsafe_dn[0].GetTestDir() + "replica6b.part1"}}};
+      tc.poolset =
+          PoolsetBuilder{unsafe_dn[0].GetTestDir(), "pool6" + sfx + ".set"}
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master6.part0"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master6.part1"))
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "master6.part2"))
+              .AddReplica()
+              .AddPart(part(unsafe_dn[1].GetTestDir(), "replica6a.part0"))
+              .AddPart(
+                  double_part(unsafe_dn[1].GetTestDir(), "replica6a.part1"))
+              .AddReplica()
+              .AddPart(part(unsafe_dn[0].GetTestDir(), "replica6b.part0"))
+              .AddPart(
+                  double_part(unsafe_dn[0].GetTestDir(), "replica6b.part1"))
+              .Build();
       tc.is_syncable = false;
     } else {
       tc.enough_dimms = false;
@@ -311,6 +440,18 @@ std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
   return ret_vec;
 }
 
+std::vector<sync_local_replica_tc> GetSyncLocalReplicaParams() {
+  std::vector<sync_local_replica_tc> ret_vec;
+  for (const auto& size : LocalTestPhase::GetInstance().GetPoolSizes()) {
+    for (auto tc : GetSyncLocalReplicaParams(size)) {
+      tc.pool_size = size.size;
+      tc.description += ", pool size: " + size.description;
+      ret_vec.emplace_back(tc);
+    }
+  }
+  return ret_vec;
+}
+
 INSTANTIATE_TEST_CASE_P(UnsafeShutdown, SyncLocalReplica,
                         ::testing::ValuesIn(GetSyncLocalReplicaParams()));
 
@@ -432,3 +573,219 @@ TEST_F(UnsafeShutdownTransform, TC_TRANSFORM_POOLSET_TO_US_DIMM_phase_2) {
   ObjData<int> pd{pop_};
   ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
 }
+
+void UnsafeShutdownTransformInterrupted::SetUp() {
+  const auto& us_dn = test_phase_.GetUnsafeDimmNamespaces();
+  const auto& non_us_dn = test_phase_.GetSafeDimmNamespaces();
+
+  ASSERT_LE(1, us_dn.size())
+      << "Insufficient number of unsafely shutdown DIMMs to run this test";
+  ASSERT_LE(1, non_us_dn.size())
+      << "Insufficient number of safely shutdown DIMMs to run this test";
+
+  const size_t pool_size = GetParam().size;
+  const std::string sfx = "_" + std::to_string(pool_size);
+  const std::string part =
+      std::to_string(GetPartSize(pool_size, 3) / KIBIBYTE) + "KiB ";
+  const std::string double_part =
+      std::to_string(GetPartSize(pool_size, 3, 2) / KIBIBYTE) + "KiB ";
+  std::string master_path = non_us_dn[0].GetTestDir() + "master12" + sfx;
+  std::string replica_path = non_us_dn[0].GetTestDir() + "replica12" + sfx;
+  std::string added_path = us_dn[0].GetTestDir() + "replica12" + sfx;
+
+  origin_ = Poolset(non_us_dn[0].GetTestDir(), "pool12_origin" + sfx + ".set",
+                    {
+                        {"PMEMPOOLSET", part + master_path + ".part0",
+                         part + master_path + ".part1",
+                         part + master_path + ".part2"},
+                        {"REPLICA", part + replica_path + ".part0",
+                         double_part + replica_path + ".part1"},
+                    });
+  added_ = Poolset(non_us_dn[0].GetTestDir(), "pool12_added" + sfx + ".set",
+                   {
+                       {"PMEMPOOLSET", part + master_path + ".part0",
+                        part + master_path + ".part1",
+                        part + master_path + ".part2"},
+                       {"REPLICA", part + replica_path + ".part0",
+                        double_part + replica_path + ".part1"},
+                       {"REPLICA", part + added_path + ".part0",
+                        double_part + added_path + ".part1"},
+                   });
+  final_ = Poolset(non_us_dn[0].GetTestDir(), "pool12_final" + sfx + ".set",
+                   {
+                       {"PMEMPOOLSET", part + master_path + ".part0",
+                        part + master_path + ".part1",
+                        part + master_path + ".part2"},
+                       {"REPLICA", part + added_path + ".part0",
+                        double_part + added_path + ".part1"},
+                   });
+
+  transform_marker_ =
+      test_phase_.GetTestDir() + GetNormalizedTestName() + "_transform_done";
+  flight_path_ = added_path + "_flight";
+  RecordProperty("pool_size", std::to_string(pool_size));
+  UnsafeShutdown::SetUp();
+}
+
+std::string UnsafeShutdownTransformInterrupted::VerifyPool(
+    const Poolset& ps) const {
+  PMEMobjpool* pop = pmemobj_open(ps.GetFullPath().c_str(), nullptr);
+  if (pop == nullptr) {
+    return "Opening pool " + ps.GetFullPath() +
+           " failed. Errno: " + std::to_string(errno) + "\n" +
+           pmemobj_errormsg();
+  }
+
+  ObjData<int> pd{pop};
+  bool equal = obj_data_ == pd.Read();
+  pmemobj_close(pop);
+  if (!equal) {
+    return "Data read from pool " + ps.GetFullPath() +
+           " differs from written";
+  }
+  return "";
+}
+
+/**
+ * TC_TRANSFORM_INTERRUPTED
+ * Create pool from poolset with primary pool and replica on safely shutdown
+ * DIMM, trigger US while pmempool_transform adds replica on unsafely shutdown
+ * DIMM, recover and finish the transformation.
+ * \test
+ *          \li \c Step1. Create pool from origin poolset, write pattern to the
+ * pool / SUCCESS
+ *          \li \c Step2. Trigger US, run power cycle, check USC values /
+ * SUCCESS
+ *          \li \c Step3. Create poolset files to be transformed to / SUCCESS
+ *          \li \c Step4. Start transformation adding replica on unsafely
+ * shutdown DIMM in detached process logging its progress in flight recorder
+ * next to the added replica, wait for its first heartbeat / SUCCESS
+ *          \li \c Step5. Trigger US while transformation is running, run power
+ * cycle, check USC values / SUCCESS
+ *          \li \c Step6. Print timeline of the transformation decoded from
+ * flight recorder. If transformation was interrupted: sync origin pool,
+ * verify it, remove parts of added replica and transform it again, else:
+ * record the case as skipped, sync intermediate pool / SUCCESS
+ *          \li \c Step7. Verify intermediate pool / SUCCESS
+ *          \li \c Step8. Transform intermediate pool to target poolset, verify
+ * target pool, report recovery time / SUCCESS
+ */
+TEST_P(UnsafeShutdownTransformInterrupted, TC_TRANSFORM_INTERRUPTED_phase_1) {
+  /* Step1 */
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(origin_))
+      << "Creating poolset file " + origin_.GetFullPath() + " failed";
+  pop_ = pmemobj_create(origin_.GetFullPath().c_str(), nullptr, 0, 0644);
+  ASSERT_TRUE(pop_ != nullptr)
+      << "Error while creating the pool. Errno: " << errno << std::endl
+      << pmemobj_errormsg();
+  ObjData<int> pd{pop_};
+  ASSERT_EQ(0, pd.Write(obj_data_)) << "Writing to pool failed";
+  pmemobj_close(pop_);
+  pop_ = nullptr;
+}
+
+/* Step2 - outside of test macros */
+
+TEST_P(UnsafeShutdownTransformInterrupted, TC_TRANSFORM_INTERRUPTED_phase_2) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+
+  /* Step3 */
+  PoolsetManagement p_mgmt;
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(added_))
+      << "Creating poolset file " + added_.GetFullPath() + " failed";
+  ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(final_))
+      << "Creating poolset file " + final_.GetFullPath() + " failed";
+
+  /* Step4 */
+  const std::string origin = origin_.GetFullPath();
+  const std::string added = added_.GetFullPath();
+  DetachedOperation transform{transform_marker_};
+  transform.SetFlightRecorder(flight_path_);
+  ASSERT_EQ(0, transform.Start([origin, added] {
+    return pmempool_transform(origin.c_str(), added.c_str(), 0);
+  }));
+
+  int exit_code;
+  bool running = transform.WaitForProgress(1000, exit_code);
+  if (!running) {
+    ASSERT_EQ(0, exit_code) << "pmempool_transform failed";
+  }
+  RecordProperty("transform_running_at_end", running ? "true" : "false");
+}
+
+/* Step5 - outside of test macros */
+
+TEST_P(UnsafeShutdownTransformInterrupted, TC_TRANSFORM_INTERRUPTED_phase_3) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+
+  const std::string origin = origin_.GetFullPath();
+  const std::string added = added_.GetFullPath();
+  const std::string final = final_.GetFullPath();
+  Timer timer;
+  timer.Start();
+
+  /* Step6 */
+  std::vector<flight_event> timeline;
+  if (FlightRecorder::Decode(flight_path_, timeline) == 0) {
+    std::cout << "Transformation timeline:" << std::endl
+              << FlightRecorder::FormatTimeline(timeline, 4);
+    if (!timeline.empty()) {
+      RecordProperty("flight_last_op",
+                     FlightRecorder::ToString(timeline.back().op));
+    }
+  }
+
+  double transform_ms = 0;
+  bool interrupted =
+      !DetachedOperation{transform_marker_}.IsDone(transform_ms);
+  RecordProperty("transform_interrupted", interrupted ? "true" : "false");
+  if (!interrupted) {
+    RecordProperty("skipped",
+                   "transformation completed before unsafe shutdown");
+    std::cerr << "[ SKIPPED  ] Transformation of " << origin
+              << " completed in " << transform_ms
+              << " ms before unsafe shutdown, use bigger pool size"
+              << std::endl;
+  }
+
+  if (interrupted) {
+    ASSERT_EQ(0, Timed("sync_origin", [&origin] {
+                return pmempool_sync(origin.c_str(), 0);
+              })) << "Syncing origin pool failed";
+    std::string error =
+        Timed("verify_origin", [&] { return VerifyPool(origin_); });
+    ASSERT_TRUE(error.empty()) << error;
+
+    for (const auto& part : added_.GetReplica(2).GetParts()) {
+      if (ApiC::RegularFileExists(part.GetPath())) {
+        ASSERT_EQ(0, ApiC::RemoveFile(part.GetPath()));
+      }
+    }
+    ASSERT_EQ(0, Timed("transform_added", [&origin, &added] {
+                return pmempool_transform(origin.c_str(), added.c_str(), 0);
+              })) << "Repeated transformation failed";
+  } else {
+    ASSERT_EQ(0, Timed("sync_added", [&added] {
+                return pmempool_sync(added.c_str(), 0);
+              })) << "Syncing intermediate pool failed";
+  }
+
+  /* Step7 */
+  std::string error = Timed("verify_added", [&] { return VerifyPool(added_); });
+  ASSERT_TRUE(error.empty()) << error;
+
+  /* Step8 */
+  ASSERT_EQ(0, Timed("transform_final", [&added, &final] {
+              return pmempool_transform(added.c_str(), final.c_str(), 0);
+            })) << "Transformation to target poolset failed";
+  error = Timed("verify_final", [&] { return VerifyPool(final_); });
+  ASSERT_TRUE(error.empty()) << error;
+
+  timer.Stop();
+  RecordProperty("recovery_ms", std::to_string(timer.GetElapsed()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    UnsafeShutdown, UnsafeShutdownTransformInterrupted,
+    ::testing::ValuesIn(LocalTestPhase::GetInstance().GetPoolSizes()));
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2024, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -33,6 +33,10 @@
 #ifndef US_LOCAL_REPLICAS_TESTS_H
 #define US_LOCAL_REPLICAS_TESTS_H
 
+#include "detached_operation/detached_operation.h"
+#include "flight_recorder/flight_recorder.h"
+#include "poolset/poolset_builder.h"
+#include "replica_diff/merkle_tree.h"
 #include "unsafe_shutdown.h"
 
 struct sync_local_replica_tc {
@@ -40,6 +44,7 @@ struct sync_local_replica_tc {
   Poolset poolset;
   bool enough_dimms;
   bool is_syncable;
+  size_t pool_size;
 };
 
 class SyncLocalReplica
@@ -47,6 +52,28 @@ class SyncLocalReplica
       public ::testing::WithParamInterface<sync_local_replica_tc> {
  public:
   void SetUp() override;
+
+  /*
+   * GetSnapshotPath -- returns path of file keeping Merkle tree of master
+   * replica taken before shutdown.
+   */
+  std::string GetSnapshotPath() const {
+    return test_phase_.GetTestDir() + GetNormalizedTestName() + ".merkle";
+  }
+
+  /*
+   * pool header and obj pool descriptor, whose runtime part is written to
+   * master replica only
+   */
+  static const uint64_t POOL_DESCRIPTOR_SIZE = 8 * KIBIBYTE;
+
+  /*
+   * ReportDiff -- prints ranges of data differing between given trees and
+   * records their total size as '<name>_bytes' test property. Returns number
+   * of differing bytes past POOL_DESCRIPTOR_SIZE.
+   */
+  uint64_t ReportDiff(const std::string& name, const MerkleTree& tree,
+                      const MerkleTree& other);
 };
 
 std::ostream& operator<<(std::ostream& stream, sync_local_replica_tc const& p);
@@ -62,4 +89,24 @@ class UnsafeShutdownTransform : public UnsafeShutdown {
   void SetUp() override;
 };
 
+class UnsafeShutdownTransformInterrupted
+    : public UnsafeShutdown,
+      public ::testing::WithParamInterface<pool_size_param> {
+ public:
+  Poolset origin_;
+  Poolset added_;
+  Poolset final_;
+  std::string transform_marker_;
+  std::string flight_path_;
+
+  void SetUp() override;
+
+  /*
+   * VerifyPool -- opens pool from given poolset, verifies pattern written in
+   * the first phase and closes the pool. Returns empty string on success,
+   * error description otherwise.
+   */
+  std::string VerifyPool(const Poolset& ps) const;
+};
+
 #endif  // US_LOCAL_REPLICAS_TESTS_H
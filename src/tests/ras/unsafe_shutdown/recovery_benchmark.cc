@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "recovery_benchmark.h"
+
+std::ostream& operator<<(std::ostream& stream, recovery_param const& r) {
+  stream << r.description;
+  return stream;
+}
+
+std::vector<recovery_param> GetRecoveryParams() {
+  std::vector<recovery_param> ret_vec;
+  for (bool replicated : {false, true}) {
+    for (size_t obj_count : {1000, 10000, 100000}) {
+      recovery_param param;
+      param.description = std::to_string(obj_count) + " objects";
+      if (replicated) {
+        param.description += ", replicated";
+      }
+      param.obj_count = obj_count;
+      param.replicated = replicated;
+      ret_vec.emplace_back(param);
+    }
+  }
+
+  /* skip pools too small to hold objects with heap metadata */
+  std::vector<recovery_param> fitting;
+  for (const auto& param : WithPoolSizes(ret_vec)) {
+    if (2 * param.obj_count * RecoveryTime::obj_size_ <= param.pool_size) {
+      fitting.emplace_back(param);
+    }
+  }
+  return fitting;
+}
+
+void RecoveryTime::SetUp() {
+  const auto& unsafe_dn = test_phase_.GetUnsafeDimmNamespaces();
+  const auto& safe_dn = test_phase_.GetSafeDimmNamespaces();
+  recovery_param param = GetParam();
+
+  ASSERT_LE(1, unsafe_dn.size())
+      << "Insufficient number of DIMMs to run this test";
+  std::string name = GetNormalizedTestName();
+  if (param.replicated) {
+    ASSERT_LE(1, safe_dn.size())
+        << "Insufficient number of DIMMs to run this test";
+    std::string size = std::to_string(param.pool_size);
+    poolset_ = Poolset{
+        unsafe_dn[0].GetTestDir(),
+        name + ".set",
+        {{"PMEMPOOLSET", size + " " + unsafe_dn[0].GetTestDir() + name +
+                             "_master.part0"},
+         {"REPLICA",
+          size + " " + safe_dn[0].GetTestDir() + name + "_replica.part0"}}};
+    pool_path_ = poolset_.GetFullPath();
+  } else {
+    pool_path_ = unsafe_dn[0].GetTestDir() + name + "_pool";
+  }
+
+  RecordProperty("pool_size", std::to_string(param.pool_size));
+  RecordProperty("obj_count", std::to_string(param.obj_count));
+}
+
+/**
+ * TC_RECOVERY_TIME
+ * Measure time of recovering pool after unsafe shutdown
+ * \test
+ *          \li \c Step1. Create a pool (or pool from replicated poolset) on
+ * unsafely shutdown DIMM / SUCCESS
+ *          \li \c Step2. Allocate objects and write pattern to them / SUCCESS
+ *          \li \c Step3. Trigger US, run power cycle, check USC values /
+ * SUCCESS
+ *          \li \c Step4. Open the pool, record time / FAIL: pop = NULL,
+ * errno = EINVAL
+ *          \li \c Step5. Repair the pool or sync replicated poolset, record
+ * time / SUCCESS
+ *          \li \c Step6. Open the pool, record time / SUCCESS
+ *          \li \c Step7. Verify pattern, record time and total recovery time /
+ * SUCCESS
+ */
+TEST_P(RecoveryTime, TC_RECOVERY_TIME_phase_1) {
+  recovery_param param = GetParam();
+
+  /* Step1 */
+  if (param.replicated) {
+    PoolsetManagement p_mgmt;
+    ASSERT_EQ(0, p_mgmt.CreatePoolsetFile(poolset_))
+        << "error while creating poolset file";
+    pop_ = Timed("create", [this] {
+      return pmemobj_create(pool_path_.c_str(), nullptr, 0, 0644);
+    });
+  } else {
+    pop_ = Timed("create", [&param, this] {
+      return CreatePool(pool_path_, param.pool_size);
+    });
+  }
+  ASSERT_TRUE(pop_ != nullptr) << "Pool creating failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+
+  /* Step2 */
+  SmallObjData data{pop_, obj_size_};
+  ASSERT_EQ(0, data.Write(param.obj_count)) << "Writing objects failed";
+}
+
+/* Step3. outside of test macros */
+
+TEST_P(RecoveryTime, TC_RECOVERY_TIME_phase_2) {
+  ASSERT_TRUE(PassedOnPreviousPhase()) << "Part of test before shutdown failed";
+  recovery_param param = GetParam();
+  auto open = [this] { return pmemobj_open(pool_path_.c_str(), nullptr); };
+  Timer total;
+  total.Start();
+
+  /* Step4 */
+  pop_ = Timed("failed_open", open);
+  ASSERT_EQ(nullptr, pop_)
+      << "Pool was opened after unsafe shutdown but should be not";
+  ASSERT_EQ(EINVAL, errno);
+
+  /* Step5 */
+  if (param.replicated) {
+    ASSERT_EQ(0, Timed("sync", [this] {
+                return pmempool_sync(pool_path_.c_str(), 0);
+              })) << "Syncing pool failed";
+  } else {
+    ASSERT_EQ(PMEMPOOL_CHECK_RESULT_REPAIRED,
+              Timed("repair", [this] { return PmempoolRepair(pool_path_); }))
+        << "Pool was not repaired";
+  }
+
+  /* Step6 */
+  pop_ = Timed("open", open);
+  ASSERT_TRUE(pop_ != nullptr) << "Pool opening failed. Errno: " << errno
+                               << std::endl
+                               << pmemobj_errormsg();
+
+  /* Step7 */
+  SmallObjData data{pop_, obj_size_};
+  ASSERT_EQ(0, Timed("verify", [&data, &param] {
+              return data.Verify(param.obj_count);
+            })) << "Data read from pool differs from written";
+  total.Stop();
+  RecordProperty("total_ms", std::to_string(total.GetElapsed()));
+}
+
+INSTANTIATE_TEST_CASE_P(UnsafeShutdown, RecoveryTime,
+                        ::testing::ValuesIn(GetRecoveryParams()));
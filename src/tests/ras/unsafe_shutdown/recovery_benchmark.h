@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef US_RECOVERY_BENCHMARK_H
+#define US_RECOVERY_BENCHMARK_H
+
+#include "pool_data/small_obj_data.h"
+#include "unsafe_shutdown.h"
+
+struct recovery_param {
+  std::string description;
+  size_t pool_size;
+  size_t obj_count;
+  bool replicated;
+};
+
+std::ostream& operator<<(std::ostream& stream, recovery_param const& r);
+
+/*
+ * RecoveryTime -- fixture measuring time of steps taken after unsafe
+ * shutdown to bring pool back to usable state. Parameters combine pool sizes
+ * from config file, object counts and replication.
+ */
+class RecoveryTime : public UnsafeShutdown,
+                     public ::testing::WithParamInterface<recovery_param> {
+ public:
+  std::string pool_path_;
+  Poolset poolset_;
+  static const size_t obj_size_ = 256;
+
+  void SetUp() override;
+};
+
+std::vector<recovery_param> GetRecoveryParams();
+
+#endif  // US_RECOVERY_BENCHMARK_H
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2024, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -32,31 +32,68 @@
 
 #include "unsafe_shutdown.h"
 
+std::ostream &operator<<(std::ostream &stream, pool_size_param const &p) {
+  stream << p.description;
+  return stream;
+}
+
 std::string UnsafeShutdown::GetNormalizedTestName() const {
-  auto &test_info = GetTestInfo();
+  return GetNormalizedTestName(GetTestInfo());
+}
+
+std::string UnsafeShutdown::GetNormalizedTestName(
+    const ::testing::TestInfo &test_info) {
   std::string test_name{std::string{test_info.test_case_name()} + "_" +
                         std::string{test_info.name()}};
   string_utils::ReplaceAll(test_name, std::string{"/"}, std::string{"_"});
-  string_utils::ReplaceAll(test_name, test_phase_.GetPhaseName(),
+  string_utils::ReplaceAll(test_name,
+                           LocalTestPhase::GetInstance().GetPhaseName(),
                            std::string{""});
   return test_name;
 }
 
-void UnsafeShutdown::StampPassedResult() const {
-  if (GetTestInfo().result()->Passed()) {
-    ApiC::CreateFileT(GetPassedStamp(), "");
+void UnsafeShutdown::RecordResult() {
+  timer_.Stop();
+  pass_record record;
+  record.phase = test_phase_.GetPhaseNumber();
+  record.passed = GetTestInfo().result()->Passed();
+  record.duration_ms = static_cast<long long>(timer_.GetElapsed());
+  PassJournal::GetInstance().Record(GetNormalizedTestName(), record);
+}
+
+void UnsafeShutdown::RecordPoolStatistics() const {
+  if (!pop_) {
+    return;
+  }
+
+  pool_statistics stats;
+  if (PoolStatistics::Read(pop_, stats) != 0) {
+    return;
   }
+  stats.test_name = GetNormalizedTestName();
+  stats.phase_name = test_phase_.GetPhaseName();
+  PoolStatistics::GetInstance().Add(stats);
 }
 
 bool UnsafeShutdown:: PassedOnPreviousPhase() const {
-  bool ret = ApiC::RegularFileExists(GetPassedStamp());
-  if (ret) {
-    ApiC::RemoveFile(GetPassedStamp());
+  return PassJournal::GetInstance().Passed(GetNormalizedTestName(),
+                                           test_phase_.GetPhaseNumber() - 1);
+}
+
+int UnsafeShutdown::PmempoolRepair(std::string pool_file_path) const {
+  check_message slowest;
+  int ret = PmempoolRepair(pool_file_path, slowest);
+  if (!slowest.msg.empty()) {
+    RecordProperty("repair_slowest_step_ms",
+                   std::to_string(static_cast<long long>(slowest.delta)));
+    RecordProperty("repair_slowest_step", slowest.msg);
   }
   return ret;
 }
 
-int UnsafeShutdown::PmempoolRepair(std::string pool_file_path) const {
+int UnsafeShutdown::PmempoolRepair(const std::string &pool_file_path,
+                                   check_message &slowest) const {
+  slowest = check_message{};
   unsigned int flags = PMEMPOOL_CHECK_FORMAT_STR | PMEMPOOL_CHECK_REPAIR |
                        PMEMPOOL_CHECK_VERBOSE | PMEMPOOL_CHECK_ALWAYS_YES;
   struct pmempool_check_args args = {pool_file_path.c_str(), nullptr,
@@ -68,14 +105,14 @@ int UnsafeShutdown::PmempoolRepair(std::string pool_file_path) const {
     return -1;
   }
 
+  CheckReporter reporter{pool_file_path};
   pmempool_check_status *status;
-  std::string status_msg;
+  reporter.Start();
   while ((status = pmempool_check(ppc)) != nullptr) {
     switch (status->type) {
       case PMEMPOOL_CHECK_MSG_TYPE_ERROR:
       case PMEMPOOL_CHECK_MSG_TYPE_INFO:
-        status_msg.append(status->str.msg);
-        status_msg.append("\n");
+        reporter.Report(*status);
         break;
       default:
         pmempool_check_end(ppc);
@@ -84,7 +121,24 @@ int UnsafeShutdown::PmempoolRepair(std::string pool_file_path) const {
     }
   }
 
-  return pmempool_check_end(ppc);
+  int ret = pmempool_check_end(ppc);
+  reporter.Summarize(ret);
+
+  const check_message *message = reporter.GetSlowestMessage();
+  if (message != nullptr) {
+    slowest = *message;
+  }
+
+  return ret;
+}
+
+PMEMobjpool *UnsafeShutdown::CreatePool(const std::string &path,
+                                        size_t size) const {
+  PoolPrestage &prestage = PoolPrestage::GetInstance();
+  if (prestage.Take(path, size) || prestage.Clone(path, size) == 0) {
+    return pmemobj_create(path.c_str(), nullptr, 0, 0644);
+  }
+  return pmemobj_create(path.c_str(), nullptr, size, 0644);
 }
 
 void UnsafeShutdown::SetSdsAtCreate(bool state) const {
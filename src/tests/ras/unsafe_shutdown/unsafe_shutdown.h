@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2024, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -33,18 +33,26 @@
 #ifndef UNSAFE_SHUTDOWN_H
 #define UNSAFE_SHUTDOWN_H
 
+#include "check_reporter/check_reporter.h"
 #include "configXML/local_dimm_configuration.h"
 #include "gtest/gtest.h"
 #include "libpmempool.h"
+#include "pass_journal/pass_journal.h"
 #include "pool_data/pool_data.h"
+#include "pool_prestage/pool_prestage.h"
+#include "pool_statistics/pool_statistics.h"
 #include "poolset/poolset_management.h"
 #include "shell/i_shell.h"
 #include "test_phase/local_test_phase.h"
+#include "timer/timer.h"
 
 class UnsafeShutdown : public ::testing::Test {
  public:
   UnsafeShutdown() {
     this->close_pools_at_end_ = !test_phase_.HasInjectAtEnd();
+    if (PoolStatistics::Enable() != 0) {
+      std::cerr << "Enabling pool statistics failed" << std::endl;
+    }
   }
 
   IShell shell_;
@@ -56,13 +64,52 @@ class UnsafeShutdown : public ::testing::Test {
 
   bool PassedOnPreviousPhase() const;
   std::string GetNormalizedTestName() const;
+  static std::string GetNormalizedTestName(
+      const ::testing::TestInfo& test_info);
+
+  /*
+   * PmempoolRepair -- checks and repairs given pool, streaming timestamped
+   * check messages to stdout as they arrive. Records the slowest check step
+   * as test property. Returns result of pmempool_check_end().
+   */
   int PmempoolRepair(std::string pool_file_path) const;
 
+  /*
+   * PmempoolRepair -- checks and repairs given pool like the overload above,
+   * but stores the slowest check step in 'slowest' instead of recording it,
+   * so it can be called from worker threads.
+   */
+  int PmempoolRepair(const std::string& pool_file_path,
+                     check_message& slowest) const;
+
+  /*
+   * CreatePool -- creates obj pool of given size in file prestaged or cloned
+   * from template by PoolPrestage. Falls back to regular pool creation if
+   * neither is possible for given path.
+   */
+  PMEMobjpool* CreatePool(const std::string& path, size_t size) const;
+
+  /*
+   * Timed -- calls given function, records its execution time as
+   * '<name>_ms' test property and returns its result.
+   */
+  template <typename Function>
+  auto Timed(const std::string& name, Function function)
+      -> decltype(function()) {
+    Timer timer;
+    timer.Start();
+    auto ret = function();
+    timer.Stop();
+    RecordProperty(name + "_ms", std::to_string(timer.GetElapsed()));
+    return ret;
+  }
+
 
   void SetUp() override;
 
   ~UnsafeShutdown() {
-    StampPassedResult();
+    RecordResult();
+    RecordPoolStatistics();
     if (close_pools_at_end_) {
       if (pop_) {
         pmemobj_close(pop_);
@@ -78,11 +125,30 @@ class UnsafeShutdown : public ::testing::Test {
   const ::testing::TestInfo& GetTestInfo() const {
     return *::testing::UnitTest::GetInstance()->current_test_info();
   }
-  std::string GetPassedStamp() const {
-    return test_phase_.GetTestDir() + GetNormalizedTestName() + "_passed";
-  }
-  void StampPassedResult() const;
+  Timer timer_;
+  void RecordResult();
+  void RecordPoolStatistics() const;
   void SetSdsAtCreate(bool state) const;
 };
 
+std::ostream& operator<<(std::ostream& stream, pool_size_param const& p);
+
+/*
+ * WithPoolSizes -- returns given test parameters repeated for every pool size
+ * from LocalTestPhase::GetPoolSizes(), with 'pool_size' field set and size
+ * appended to description.
+ */
+template <typename Param>
+std::vector<Param> WithPoolSizes(const std::vector<Param>& params) {
+  std::vector<Param> ret_vec;
+  for (const auto& size : LocalTestPhase::GetInstance().GetPoolSizes()) {
+    for (auto param : params) {
+      param.pool_size = size.size;
+      param.description += ", pool size: " + size.description;
+      ret_vec.emplace_back(param);
+    }
+  }
+  return ret_vec;
+}
+
 #endif  // UNSAFE_SHUTDOWN_H
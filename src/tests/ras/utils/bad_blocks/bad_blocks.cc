@@ -0,0 +1,265 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "bad_blocks.h"
+#include <fcntl.h>
+#include <linux/falloc.h>
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <linux/limits.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#define FOREACH_BUS_REGION_NAMESPACE(ctx, bus, region, ndns)    \
+  ndctl_bus_foreach(ctx, bus) ndctl_region_foreach(bus, region) \
+      ndctl_namespace_foreach(region, ndns)
+
+BadBlocks::BadBlocks(const std::string &path) : path_(path) {
+  struct stat64 st;
+  if (stat64(path_.c_str(), &st) != 0 || ndctl_new(&ctx_) != 0) {
+    ctx_ = nullptr;
+    return;
+  }
+  ndns_ = GetNamespace(st.st_dev);
+  if (ndns_ != nullptr &&
+      ndctl_bus_has_error_injection(ndctl_namespace_get_bus(ndns_)) == 1) {
+    backend_ = BadBlockBackend::ndctl;
+  }
+}
+
+ndctl_namespace *BadBlocks::GetNamespace(dev_t dev) const {
+  struct ndctl_bus *bus;
+  struct ndctl_region *region;
+  struct ndctl_namespace *ndns;
+
+  FOREACH_BUS_REGION_NAMESPACE(ctx_, bus, region, ndns) {
+    /* device DAX has no file system, sector namespaces are not supported */
+    if (ndctl_namespace_get_dax(ndns) || ndctl_namespace_get_btt(ndns)) {
+      continue;
+    }
+    struct ndctl_pfn *pfn = ndctl_namespace_get_pfn(ndns);
+    const char *devname = pfn ? ndctl_pfn_get_block_device(pfn)
+                              : ndctl_namespace_get_block_device(ndns);
+    if (devname == nullptr || *devname == '\0') {
+      continue;
+    }
+
+    char path[PATH_MAX];
+    struct stat64 st;
+    if (snprintf(path, sizeof(path), "/dev/%s", devname) < 0 ||
+        stat64(path, &st) != 0) {
+      continue;
+    }
+    if (st.st_rdev == dev) {
+      return ndns;
+    }
+  }
+  return nullptr;
+}
+
+int BadBlocks::GetPhysicalOffset(int fd, uint64_t offset,
+                                 uint64_t &physical) const {
+  /* fiemap is followed by array of extents, one extent is requested */
+  alignas(struct fiemap) char
+      buffer[sizeof(struct fiemap) + sizeof(struct fiemap_extent)] = {0};
+  struct fiemap *map = reinterpret_cast<struct fiemap *>(buffer);
+  map->fm_start = offset;
+  map->fm_length = SECTOR_SIZE;
+  map->fm_flags = FIEMAP_FLAG_SYNC;
+  map->fm_extent_count = 1;
+
+  if (ioctl(fd, FS_IOC_FIEMAP, map) != 0) {
+    std::cerr << "Reading extents of " << path_
+              << " failed: " << std::strerror(errno) << std::endl;
+    return -1;
+  }
+  const struct fiemap_extent &extent = map->fm_extents[0];
+  if (map->fm_mapped_extents != 1 || offset < extent.fe_logical ||
+      offset >= extent.fe_logical + extent.fe_length) {
+    std::cerr << "Offset " << offset << " of " << path_
+              << " is not allocated" << std::endl;
+    return -1;
+  }
+  physical = extent.fe_physical + (offset - extent.fe_logical);
+  return 0;
+}
+
+int BadBlocks::PlantInNamespace(const std::vector<bad_block> &blocks) {
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd == -1) {
+    std::cerr << "Opening " << path_ << " failed: " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  int ret = 0;
+  for (const auto &block : blocks) {
+    /* every sector is translated, as blocks may span several extents */
+    for (uint64_t off = 0; off < block.length && ret == 0;
+         off += SECTOR_SIZE) {
+      uint64_t physical;
+      if (GetPhysicalOffset(fd, block.offset + off, physical) != 0) {
+        ret = -1;
+        break;
+      }
+      uint64_t sector = physical / SECTOR_SIZE;
+      if (!injected_.empty() &&
+          injected_.back().offset + injected_.back().length == sector) {
+        ++injected_.back().length;
+      } else {
+        injected_.emplace_back(bad_block{sector, 1});
+      }
+    }
+  }
+  close(fd);
+  if (ret != 0) {
+    injected_.clear();
+    return -1;
+  }
+
+  for (const auto &range : injected_) {
+    int err = ndctl_namespace_inject_error(ndns_, range.offset, range.length,
+                                           true);
+    if (err != 0) {
+      std::cerr << "Injecting error into "
+                << ndctl_namespace_get_devname(ndns_)
+                << " failed: " << std::strerror(-err) << std::endl;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int BadBlocks::PlantInFile(const std::vector<bad_block> &blocks) const {
+  int fd = open(path_.c_str(), O_RDWR);
+  if (fd == -1) {
+    std::cerr << "Opening " << path_ << " failed: " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  int ret = 0;
+  std::vector<char> zeros;
+  for (const auto &block : blocks) {
+    if (fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                  static_cast<off_t>(block.offset),
+                  static_cast<off_t>(block.length)) == 0) {
+      continue;
+    }
+    /* file system cannot punch holes, data is lost the same way */
+    zeros.resize(block.length, 0);
+    if (pwrite(fd, zeros.data(), block.length,
+               static_cast<off_t>(block.offset)) !=
+        static_cast<ssize_t>(block.length)) {
+      std::cerr << "Discarding data of " << path_
+                << " failed: " << std::strerror(errno) << std::endl;
+      ret = -1;
+      break;
+    }
+  }
+  close(fd);
+  return ret;
+}
+
+int BadBlocks::Plant(const std::vector<bad_block> &blocks,
+                     unsigned timeout_s) {
+  for (const auto &block : blocks) {
+    if (block.offset % SECTOR_SIZE != 0 || block.length % SECTOR_SIZE != 0 ||
+        block.length == 0) {
+      std::cerr << "Bad block is not aligned to " << SECTOR_SIZE << " bytes"
+                << std::endl;
+      return -1;
+    }
+  }
+
+  if (backend_ == BadBlockBackend::file) {
+    return PlantInFile(blocks);
+  }
+
+  if (PlantInNamespace(blocks) != 0) {
+    return -1;
+  }
+
+  size_t planted = 0;
+  for (const auto &range : injected_) {
+    planted += range.length;
+  }
+  auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(timeout_s);
+  while (GetRemaining() < planted) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      std::cerr << "Kernel reports " << GetRemaining() << " of " << planted
+                << " injected bad sectors" << std::endl;
+      return -1;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  return 0;
+}
+
+size_t BadBlocks::GetRemaining() const {
+  if (backend_ == BadBlockBackend::file) {
+    return 0;
+  }
+
+  size_t remaining = 0;
+  struct badblock *bb;
+  ndctl_namespace_badblock_foreach(ndns_, bb) {
+    for (const auto &range : injected_) {
+      uint64_t begin = std::max<uint64_t>(bb->offset, range.offset);
+      uint64_t end =
+          std::min<uint64_t>(bb->offset + bb->len, range.offset + range.length);
+      if (begin < end) {
+        remaining += end - begin;
+      }
+    }
+  }
+  return remaining;
+}
+
+BadBlocks::~BadBlocks() {
+  if (backend_ == BadBlockBackend::ndctl) {
+    for (const auto &range : injected_) {
+      ndctl_namespace_uninject_error(ndns_, range.offset, range.length, true);
+    }
+  }
+  if (ctx_ != nullptr) {
+    ndctl_unref(ctx_);
+  }
+}
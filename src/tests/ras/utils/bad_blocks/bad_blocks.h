@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_BAD_BLOCKS_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_BAD_BLOCKS_H_
+
+#include <ndctl/libndctl.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * BadBlockBackend -- method of planting bad blocks:
+ * ndctl - media errors are injected into namespace holding the file with
+ * ndctl_namespace_inject_error(), which is supported by nfit_test module and
+ * by platforms with ACPI error injection,
+ * file - stand-in used when injection is unavailable; data of bad blocks is
+ * discarded by punching holes in the file. libpmempool cannot detect such
+ * blocks, so they must be accompanied by damage it does detect.
+ */
+enum class BadBlockBackend { ndctl, file };
+
+/*
+ * bad_block -- range of file planted as bad, offset and length are specified
+ * in bytes and aligned to 512 bytes.
+ */
+struct bad_block {
+  uint64_t offset;
+  uint64_t length;
+};
+
+/*
+ * BadBlocks -- class that plants bad blocks in a file. Errors injected into
+ * namespace are removed by destructor, unless they were cleared earlier.
+ */
+class BadBlocks final : NonCopyable {
+ private:
+  static const uint64_t SECTOR_SIZE = 512;
+  std::string path_;
+  BadBlockBackend backend_ = BadBlockBackend::file;
+  ndctl_ctx *ctx_ = nullptr;
+  ndctl_namespace *ndns_ = nullptr;
+  /* injected ranges of namespace, in sectors */
+  std::vector<bad_block> injected_;
+
+  ndctl_namespace *GetNamespace(dev_t dev) const;
+  int GetPhysicalOffset(int fd, uint64_t offset, uint64_t &physical) const;
+  int PlantInNamespace(const std::vector<bad_block> &blocks);
+  int PlantInFile(const std::vector<bad_block> &blocks) const;
+
+ public:
+  /*
+   * BadBlocks -- selects ndctl backend if the file is placed on namespace with
+   * error injection support, file backend otherwise.
+   */
+  explicit BadBlocks(const std::string &path);
+
+  BadBlockBackend GetBackend() const {
+    return backend_;
+  }
+
+  static std::string ToString(BadBlockBackend backend) {
+    return backend == BadBlockBackend::ndctl ? "ndctl" : "file";
+  }
+
+  /*
+   * Plant -- makes given ranges of the file bad. With ndctl backend waits up
+   * to 'timeout_s' seconds until the kernel reports all of them. Returns 0 on
+   * success, prints error message and returns -1 otherwise.
+   */
+  int Plant(const std::vector<bad_block> &blocks, unsigned timeout_s = 10);
+
+  /*
+   * GetRemaining -- returns number of sectors planted with ndctl backend that
+   * are still reported as bad by the kernel. Always 0 for file backend.
+   */
+  size_t GetRemaining() const;
+
+  ~BadBlocks();
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_BAD_BLOCKS_H_
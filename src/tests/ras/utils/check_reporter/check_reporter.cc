@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "check_reporter.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+void CheckReporter::Start() {
+  messages_.clear();
+  start_ = last_ = std::chrono::steady_clock::now();
+  stream_ << "[  CHECK   ] " << pool_path_ << ": started" << std::endl;
+}
+
+void CheckReporter::Report(const pmempool_check_status &status) {
+  auto now = std::chrono::steady_clock::now();
+  check_message message;
+  message.timestamp = GetElapsed(start_, now);
+  message.delta = GetElapsed(last_, now);
+  message.type =
+      status.type == PMEMPOOL_CHECK_MSG_TYPE_ERROR
+          ? "ERROR"
+          : status.type == PMEMPOOL_CHECK_MSG_TYPE_QUESTION ? "QUESTION"
+                                                            : "INFO";
+  message.msg = status.str.msg != nullptr ? status.str.msg : "";
+  last_ = now;
+
+  /* format in local stream to keep flags of shared one intact */
+  std::ostringstream line;
+  line << "[  CHECK   ] " << std::fixed << std::setprecision(3) << "+"
+       << message.timestamp << " ms (" << message.delta << " ms) "
+       << message.type << ": " << message.msg << std::endl;
+  stream_ << line.str();
+  messages_.emplace_back(message);
+}
+
+const check_message *CheckReporter::GetSlowestMessage() const {
+  auto slowest = std::max_element(
+      messages_.begin(), messages_.end(),
+      [](const check_message &a, const check_message &b) {
+        return a.delta < b.delta;
+      });
+  return slowest == messages_.end() ? nullptr : &*slowest;
+}
+
+void CheckReporter::Summarize(int result, size_t slowest_count) const {
+  std::vector<check_message> slowest{messages_};
+  std::sort(slowest.begin(), slowest.end(),
+            [](const check_message &a, const check_message &b) {
+              return a.delta > b.delta;
+            });
+  slowest.resize(std::min(slowest_count, slowest.size()));
+
+  std::ostringstream summary;
+  summary << "[  CHECK   ] " << pool_path_ << ": finished with result "
+          << result << " in " << std::fixed << std::setprecision(3)
+          << GetElapsed(start_, std::chrono::steady_clock::now()) << " ms, "
+          << messages_.size() << " messages" << std::endl;
+  for (const auto &m : slowest) {
+    summary << "[  CHECK   ]   " << m.delta << " ms before: " << m.msg
+            << std::endl;
+  }
+  stream_ << summary.str();
+}
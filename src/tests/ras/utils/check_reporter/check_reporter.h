@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_CHECK_REPORTER_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_CHECK_REPORTER_H_
+
+#include <libpmempool.h>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * check_message -- pmempool_check status with time elapsed since the start of
+ * the check and since the previous status, in milliseconds.
+ */
+struct check_message {
+  double timestamp;
+  double delta;
+  std::string type;
+  std::string msg;
+};
+
+/*
+ * CheckReporter -- class that streams pmempool_check statuses as they arrive,
+ * each prefixed with monotonic timestamp, and summarizes which check steps
+ * took the most time.
+ */
+class CheckReporter final : NonCopyable {
+ private:
+  std::ostream &stream_;
+  std::string pool_path_;
+  std::chrono::steady_clock::time_point start_;
+  std::chrono::steady_clock::time_point last_;
+  std::vector<check_message> messages_;
+
+  double GetElapsed(std::chrono::steady_clock::time_point since,
+                    std::chrono::steady_clock::time_point until) const {
+    return std::chrono::duration<double, std::milli>(until - since).count();
+  }
+
+ public:
+  CheckReporter(const std::string &pool_path, std::ostream &stream = std::cout)
+      : stream_(stream), pool_path_(pool_path) {
+  }
+
+  /*
+   * Start -- marks the beginning of the check, should be called right before
+   * the first pmempool_check() call.
+   */
+  void Start();
+
+  /*
+   * Report -- timestamps given status and prints it immediately.
+   */
+  void Report(const pmempool_check_status &status);
+
+  /*
+   * Summarize -- prints result of the check, total time, number of messages
+   * and the slowest steps, i.e. messages preceded by the longest gaps.
+   */
+  void Summarize(int result, size_t slowest_count = 3) const;
+
+  const std::vector<check_message> &GetMessages() const {
+    return messages_;
+  }
+
+  /*
+   * GetSlowestMessage -- returns message preceded by the longest gap or
+   * nullptr if no message was reported.
+   */
+  const check_message *GetSlowestMessage() const;
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_CHECK_REPORTER_H_
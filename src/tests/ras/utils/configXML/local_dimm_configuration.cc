@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2019, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -53,6 +53,65 @@ int LocalDimmConfiguration::SetDimmNamespaces(pugi::xml_node &&node) {
   return ret;
 }
 
+int LocalDimmConfiguration::SetUscBackend(pugi::xml_node &&node) {
+  /* uscBackend node is optional, ndctl is used by default */
+  if (node.empty()) {
+    return 0;
+  }
+
+  std::map<std::string, UscBackend> backends = {{"ndctl", UscBackend::ndctl},
+                                                {"pmem2", UscBackend::pmem2}};
+  auto search = backends.find(node.text().get());
+  if (search == backends.end()) {
+    std::cerr << "Invalid uscBackend value: " << node.text().get()
+              << ". Valid values: ndctl, pmem2" << std::endl;
+    return -1;
+  }
+  usc_backend_ = search->second;
+  return 0;
+}
+
+int LocalDimmConfiguration::SetPoolSizes(pugi::xml_node &&node) {
+  /* poolSizes node is optional */
+  for (auto &&it : node.children("poolSize")) {
+    std::string size = it.text().get();
+    if (size.empty()) {
+      std::cerr << "poolSize field is empty" << std::endl;
+      return -1;
+    }
+    pool_sizes_.emplace_back(size);
+  }
+
+  return 0;
+}
+
+int LocalDimmConfiguration::SetWorkers(pugi::xml_node &&node) {
+  /* workers node is optional, tests are run in single process by default */
+  if (node.empty()) {
+    return 0;
+  }
+
+  std::string value = node.text().get();
+  if (value == "auto") {
+    workers_ = 0;
+    return 0;
+  }
+
+  try {
+    size_t pos = 0;
+    long long workers = std::stoll(value, &pos);
+    if (pos != value.size() || workers < 1) {
+      throw std::invalid_argument(value);
+    }
+    workers_ = static_cast<unsigned>(workers);
+  } catch (const std::logic_error &) {
+    std::cerr << "Invalid workers value: " << value
+              << ". Valid values: positive integer, auto" << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
 int LocalDimmConfiguration::FillConfigFields(pugi::xml_node &&root) {
   root = root.child("localConfiguration");
 
@@ -62,7 +121,10 @@ int LocalDimmConfiguration::FillConfigFields(pugi::xml_node &&root) {
   }
 
   if (SetTestDir(root, test_dir_) != 0 ||
-      SetDimmNamespaces(root.child("dimmConfiguration")) != 0) {
+      SetDimmNamespaces(root.child("dimmConfiguration")) != 0 ||
+      SetUscBackend(root.child("uscBackend")) != 0 ||
+      SetPoolSizes(root.child("poolSizes")) != 0 ||
+      SetWorkers(root.child("workers")) != 0) {
     return -1;
   }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -35,6 +35,7 @@
 
 #include "configXML/read_config.h"
 #include "dimm/dimm.h"
+#include "inject_manager/inject_manager.h"
 #include "pugixml.hpp"
 
 class LocalDimmConfiguration final : public ReadConfig<LocalDimmConfiguration> {
@@ -42,13 +43,29 @@ class LocalDimmConfiguration final : public ReadConfig<LocalDimmConfiguration> {
   friend class ReadConfig<LocalDimmConfiguration>;
   std::string test_dir_;
   std::vector<DimmNamespace> dimm_namespaces_;
+  UscBackend usc_backend_ = UscBackend::ndctl;
+  std::vector<std::string> pool_sizes_;
+  unsigned workers_ = 1;
   int FillConfigFields(pugi::xml_node &&root);
   int SetDimmNamespaces(pugi::xml_node &&node);
+  int SetUscBackend(pugi::xml_node &&node);
+  int SetPoolSizes(pugi::xml_node &&node);
+  int SetWorkers(pugi::xml_node &&node);
 
  public:
   const std::string &GetTestDir() const {
     return this->test_dir_;
   }
+  UscBackend GetUscBackend() const {
+    return this->usc_backend_;
+  }
+  const std::vector<std::string> &GetPoolSizes() const {
+    return this->pool_sizes_;
+  }
+  /* GetWorkers -- returns number of worker processes, 0 stands for 'auto' */
+  unsigned GetWorkers() const {
+    return this->workers_;
+  }
   DimmNamespace &operator[](int idx) {
     return dimm_namespaces_.at(idx);
   }
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "detached_operation.h"
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "api_c/api_c.h"
+#include "flight_recorder/flight_recorder.h"
+#include "timer/timer.h"
+
+int DetachedOperation::RunRecorded(
+    const std::function<int()> &operation) const {
+  FlightRecorder recorder;
+  if (recorder.Create(flight_path_, 1) != 0) {
+    return -1;
+  }
+  std::unique_ptr<FlightRing> ring = recorder.GetRing();
+  ring->Log(FlightOp::start, 0);
+  ring->Flush();
+
+  Timer timer;
+  timer.Start();
+  std::future<int> result = std::async(std::launch::async, operation);
+  while (result.wait_for(std::chrono::milliseconds(heartbeat_ms_)) ==
+         std::future_status::timeout) {
+    timer.Stop();
+    ring->Log(FlightOp::heartbeat, static_cast<uint64_t>(timer.GetElapsed()));
+    ring->Flush();
+  }
+  int ret = result.get();
+  ring->Log(FlightOp::done, static_cast<uint64_t>(ret));
+  ring->Flush();
+  return ret;
+}
+
+int DetachedOperation::Start(std::function<int()> operation) {
+  ApiC::RemoveFile(marker_path_);
+  if (!flight_path_.empty()) {
+    ApiC::RemoveFile(flight_path_);
+  }
+  std::cout.flush();
+  std::cerr.flush();
+
+  pid_ = fork();
+  if (pid_ == -1) {
+    std::cerr << "fork failed: " << std::strerror(errno) << std::endl;
+    return -1;
+  }
+  if (pid_ != 0) {
+    return 0;
+  }
+
+  /* remote agent waits for streams of test binary to be closed */
+  setsid();
+  int null_fd = open("/dev/null", O_RDWR);
+  if (null_fd != -1) {
+    dup2(null_fd, STDIN_FILENO);
+    dup2(null_fd, STDOUT_FILENO);
+    dup2(null_fd, STDERR_FILENO);
+    close(null_fd);
+  }
+
+  Timer timer;
+  timer.Start();
+  int ret = flight_path_.empty() ? operation() : RunRecorded(operation);
+  timer.Stop();
+  if (ret == 0 && ApiC::CreateFileDurably(
+                      marker_path_, std::to_string(timer.GetElapsed())) != 0) {
+    ret = -1;
+  }
+  _exit(ret == 0 ? 0 : 1);
+}
+
+bool DetachedOperation::IsRunning(int timeout_ms, int &exit_code) const {
+  const int interval_ms = 10;
+  for (int waited = 0;; waited += interval_ms) {
+    int status;
+    pid_t ret = waitpid(pid_, &status, WNOHANG);
+    if (ret == pid_) {
+      exit_code = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+      return false;
+    }
+    if (ret == -1) {
+      exit_code = -1;
+      return false;
+    }
+    if (waited >= timeout_ms) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+  }
+}
+
+bool DetachedOperation::WaitForProgress(int timeout_ms, int &exit_code) const {
+  const int interval_ms = 10;
+  for (int waited = 0; waited < timeout_ms; waited += interval_ms) {
+    if (!IsRunning(interval_ms, exit_code)) {
+      return false;
+    }
+
+    std::vector<flight_event> timeline;
+    if (!flight_path_.empty() && ApiC::RegularFileExists(flight_path_) &&
+        FlightRecorder::Decode(flight_path_, timeline) == 0) {
+      for (const auto &event : timeline) {
+        if (event.op == FlightOp::heartbeat) {
+          return IsRunning(0, exit_code);
+        }
+      }
+    }
+  }
+  return IsRunning(0, exit_code);
+}
+
+bool DetachedOperation::IsDone(double &duration_ms) const {
+  std::string content;
+  if (!ApiC::RegularFileExists(marker_path_) ||
+      ApiC::ReadFile(marker_path_, content) != 0) {
+    return false;
+  }
+  duration_ms = std::atof(content.c_str());
+  return true;
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_DETACHED_OPERATION_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_DETACHED_OPERATION_H_
+
+#include <sys/types.h>
+#include <functional>
+#include <string>
+
+/*
+ * DetachedOperation -- class that runs long operation (e.g. pmempool_sync)
+ * in background process detached from the test binary, so the operation
+ * keeps running after the phase ends and can be interrupted by power cycle.
+ * Completion of the operation is stamped with marker file, written durably,
+ * which holds operation duration in milliseconds. Optionally the process logs
+ * start, periodic heartbeats and result of the operation in flight recorder,
+ * which stays mapped until the process ends.
+ */
+class DetachedOperation final {
+ private:
+  pid_t pid_ = -1;
+  std::string marker_path_;
+  std::string flight_path_;
+  int heartbeat_ms_ = 0;
+
+  int RunRecorded(const std::function<int()> &operation) const;
+
+ public:
+  explicit DetachedOperation(const std::string &marker_path)
+      : marker_path_(marker_path) {
+  }
+
+  /*
+   * SetFlightRecorder -- makes the process create flight recorder in given
+   * path and log start of the operation, heartbeat every given interval while
+   * it runs and its result, each made persistent at once.
+   */
+  void SetFlightRecorder(const std::string &path, int heartbeat_ms = 50) {
+    flight_path_ = path;
+    heartbeat_ms_ = heartbeat_ms;
+  }
+
+  /*
+   * Start -- forks process which detaches from session and standard streams of
+   * the test binary, runs given operation and creates marker file if the
+   * operation returns 0. Returns 0 on success, prints error message and
+   * returns -1 otherwise.
+   */
+  int Start(std::function<int()> operation);
+
+  /*
+   * IsRunning -- waits up to given time for the operation to finish. Returns
+   * true if it is still running, false otherwise, in which case exit code of
+   * the process is stored in exit_code.
+   */
+  bool IsRunning(int timeout_ms, int &exit_code) const;
+
+  /*
+   * WaitForProgress -- waits until the operation logs its first heartbeat in
+   * flight recorder, or up to given time if it logs none. Returns true if it
+   * is still running, false if it finished first, in which case exit code of
+   * the process is stored in exit_code.
+   */
+  bool WaitForProgress(int timeout_ms, int &exit_code) const;
+
+  /*
+   * IsDone -- returns true if operation stamped its completion, reading its
+   * duration in milliseconds into duration_ms.
+   */
+  bool IsDone(double &duration_ms) const;
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_DETACHED_OPERATION_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2023, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -42,42 +42,49 @@ const int USC_VALID_FLAG = 1 << 5;
 
 int Dimm::GetShutdownCount() const {
   struct ndctl_cmd *cmd = ndctl_dimm_cmd_new_smart(dimm_);
-
-  if (ndctl_cmd_submit(cmd)) {
+  if (cmd == nullptr) {
     return -1;
   }
 
-  if (!(ndctl_cmd_smart_get_flags(cmd) & USC_VALID_FLAG)) {
-    return -1;
+  int ret = -1;
+  if (ndctl_cmd_submit(cmd) == 0 &&
+      (ndctl_cmd_smart_get_flags(cmd) & USC_VALID_FLAG)) {
+    ret = ndctl_cmd_smart_get_shutdown_count(cmd);
   }
 
-  return ndctl_cmd_smart_get_shutdown_count(cmd);
+  ndctl_cmd_unref(cmd);
+  return ret;
 }
 
 int Dimm::InjectUnsafeShutdown() const {
   struct ndctl_cmd *cmd = ndctl_dimm_cmd_new_ack_shutdown_count(dimm_);
-
-  if (ndctl_cmd_submit(cmd)) {
+  if (cmd == nullptr) {
     return -1;
   }
 
-  if (ndctl_cmd_get_firmware_status(cmd)) {
+  int ret = ndctl_cmd_submit(cmd);
+  if (ret == 0 && ndctl_cmd_get_firmware_status(cmd)) {
     std::cerr << "DIMM: " << ndctl_dimm_get_devname(dimm_)
               << " Latch System Shutdown setting failed" << std::endl;
+    ret = -1;
+  }
+  ndctl_cmd_unref(cmd);
+  if (ret != 0) {
     return -1;
   }
 
   cmd = ndctl_dimm_cmd_new_smart_inject(dimm_);
-
-  if (ndctl_cmd_smart_inject_unsafe_shutdown(cmd, true)) {
+  if (cmd == nullptr) {
     return -1;
   }
 
-  if (ndctl_cmd_submit(cmd)) {
-    return -1;
+  ret = 0;
+  if (ndctl_cmd_smart_inject_unsafe_shutdown(cmd, true) ||
+      ndctl_cmd_submit(cmd)) {
+    ret = -1;
   }
-
-  return 0;
+  ndctl_cmd_unref(cmd);
+  return ret;
 }
 
 ndctl_interleave_set *DimmNamespace::GetInterleaveSet(ndctl_ctx *ctx,
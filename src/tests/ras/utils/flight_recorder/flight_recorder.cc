@@ -0,0 +1,268 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "flight_recorder.h"
+#include <libpmem.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace {
+const char SIGNATURE[8] = "PMDKFLR";
+const uint32_t VERSION = 2;
+
+/*
+ * flight_header -- header placed at the beginning of the file, rings follow
+ * it one after another.
+ */
+struct flight_header {
+  char signature[8];
+  uint32_t version;
+  uint32_t rings;
+  uint64_t ring_entries;
+  double ticks_per_us;
+  char unused[32];
+};
+
+uint64_t ReadTimestamp() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+double CalibrateTimestamp() {
+  auto start = std::chrono::steady_clock::now();
+  uint64_t start_ticks = ReadTimestamp();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  uint64_t ticks = ReadTimestamp() - start_ticks;
+  double us = std::chrono::duration<double, std::micro>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+  return static_cast<double>(ticks) / us;
+}
+
+uint32_t Checksum(const flight_entry &entry) {
+  uint64_t x = entry.seq * 0x9E3779B97F4A7C15ULL;
+  x ^= entry.arg * 0xC2B2AE3D27D4EB4FULL;
+  x ^= entry.timestamp * 0x165667B19E3779F9ULL;
+  x ^= static_cast<uint64_t>(entry.op) * 0x27D4EB2F165667C5ULL;
+  return static_cast<uint32_t>(x ^ (x >> 32));
+}
+}
+
+void FlightRing::Persist(const void *addr, size_t len) const {
+  if (is_pmem_) {
+    pmem_persist(addr, len);
+  } else {
+    pmem_msync(addr, len);
+  }
+}
+
+void FlightRing::Log(FlightOp op, uint64_t arg) {
+  flight_entry &entry = entries_[seq_ % capacity_];
+  entry.seq = ++seq_;
+  entry.arg = arg;
+  entry.timestamp = ReadTimestamp();
+  entry.op = static_cast<uint32_t>(op);
+  entry.checksum = Checksum(entry);
+
+  if (seq_ - flushed_ >= FLUSH_INTERVAL) {
+    Flush();
+  }
+}
+
+void FlightRing::Flush() {
+  if (seq_ == flushed_) {
+    return;
+  }
+
+  uint64_t count = std::min(seq_ - flushed_, capacity_);
+  uint64_t first = (seq_ - count) % capacity_;
+  uint64_t head = std::min(count, capacity_ - first);
+  Persist(&entries_[first], head * sizeof(flight_entry));
+  if (count > head) {
+    Persist(&entries_[0], (count - head) * sizeof(flight_entry));
+  }
+  flushed_ = seq_;
+}
+
+int FlightRecorder::Create(const std::string &path, unsigned rings,
+                           uint64_t ring_entries) {
+  size_t len = sizeof(flight_header) +
+               static_cast<size_t>(rings) * ring_entries * sizeof(flight_entry);
+  /* calibrated before the file appears, as header is read by other processes
+   * while rings are written */
+  double ticks_per_us = CalibrateTimestamp();
+  int is_pmem = 0;
+  addr_ = pmem_map_file(path.c_str(), len, PMEM_FILE_CREATE | PMEM_FILE_EXCL,
+                        0644, &mapped_len_, &is_pmem);
+  if (addr_ == nullptr) {
+    std::cerr << "Creating flight recorder " << path
+              << " failed: " << pmem_errormsg() << std::endl;
+    return -1;
+  }
+  is_pmem_ = is_pmem != 0;
+  rings_ = rings;
+  ring_entries_ = ring_entries;
+
+  flight_header *header = static_cast<flight_header *>(addr_);
+  std::memset(header, 0, sizeof(flight_header));
+  std::memcpy(header->signature, SIGNATURE, sizeof(SIGNATURE));
+  header->version = VERSION;
+  header->rings = rings;
+  header->ring_entries = ring_entries;
+  header->ticks_per_us = ticks_per_us;
+  if (is_pmem_) {
+    pmem_persist(header, sizeof(flight_header));
+  } else {
+    pmem_msync(header, sizeof(flight_header));
+  }
+  return 0;
+}
+
+std::unique_ptr<FlightRing> FlightRecorder::GetRing() {
+  unsigned ring = next_ring_.fetch_add(1);
+  if (addr_ == nullptr || ring >= rings_) {
+    return nullptr;
+  }
+
+  flight_entry *entries = reinterpret_cast<flight_entry *>(
+      static_cast<char *>(addr_) + sizeof(flight_header));
+  return std::unique_ptr<FlightRing>(
+      new FlightRing(entries + ring * ring_entries_, ring_entries_, is_pmem_));
+}
+
+int FlightRecorder::Decode(const std::string &path,
+                           std::vector<flight_event> &timeline) {
+  std::ifstream file{path, std::ios::binary};
+  flight_header header;
+  if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      std::memcmp(header.signature, SIGNATURE, sizeof(SIGNATURE)) != 0 ||
+      header.version != VERSION || header.ticks_per_us <= 0) {
+    std::cerr << "Invalid flight recorder file: " << path << std::endl;
+    return -1;
+  }
+
+  std::vector<flight_entry> entries(header.ring_entries);
+  std::vector<flight_event> events;
+  uint64_t first_timestamp = UINT64_MAX;
+  for (unsigned ring = 0; ring < header.rings; ++ring) {
+    if (!file.read(reinterpret_cast<char *>(entries.data()),
+                   entries.size() * sizeof(flight_entry))) {
+      std::cerr << "Flight recorder file " << path << " is truncated"
+                << std::endl;
+      return -1;
+    }
+
+    size_t ring_start = events.size();
+    for (const auto &entry : entries) {
+      /* skip empty entries and entries torn by power failure */
+      if (entry.seq == 0 || entry.checksum != Checksum(entry)) {
+        continue;
+      }
+      first_timestamp = std::min(first_timestamp, entry.timestamp);
+      events.push_back({ring, entry.seq, static_cast<FlightOp>(entry.op),
+                        entry.arg, static_cast<double>(entry.timestamp),
+                        false});
+    }
+    auto last = std::max_element(
+        events.begin() + ring_start, events.end(),
+        [](const flight_event &a, const flight_event &b) {
+          return a.seq < b.seq;
+        });
+    if (last != events.end()) {
+      last->last_in_ring = true;
+    }
+  }
+
+  for (auto &event : events) {
+    event.time_us = (event.time_us - static_cast<double>(first_timestamp)) /
+                    header.ticks_per_us;
+  }
+  std::sort(events.begin(), events.end(),
+            [](const flight_event &a, const flight_event &b) {
+              return a.time_us < b.time_us;
+            });
+  timeline = std::move(events);
+  return 0;
+}
+
+std::string FlightRecorder::ToString(FlightOp op) {
+  switch (op) {
+    case FlightOp::start:
+      return "start";
+    case FlightOp::heartbeat:
+      return "heartbeat";
+    case FlightOp::done:
+      return "done";
+    default:
+      return "unknown";
+  }
+}
+
+std::string FlightRecorder::FormatTimeline(
+    const std::vector<flight_event> &timeline, size_t last_count) {
+  std::ostringstream out;
+  size_t start = timeline.size() > last_count ? timeline.size() - last_count
+                                              : 0;
+  out << std::fixed << std::setprecision(3);
+  for (size_t i = start; i < timeline.size(); ++i) {
+    const flight_event &e = timeline[i];
+    out << "+" << e.time_us << " us ring " << e.ring << " #" << e.seq << " "
+        << ToString(e.op);
+    if (e.op == FlightOp::heartbeat) {
+      out << " after " << e.arg << " ms";
+    } else if (e.op == FlightOp::done) {
+      out << " result " << static_cast<int64_t>(e.arg);
+    }
+    out << (e.last_in_ring ? " <- last logged" : "") << "\n";
+  }
+  return out.str();
+}
+
+FlightRecorder::~FlightRecorder() {
+  if (addr_ != nullptr) {
+    pmem_unmap(addr_, mapped_len_);
+  }
+}
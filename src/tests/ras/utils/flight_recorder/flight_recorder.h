@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_FLIGHT_RECORDER_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_FLIGHT_RECORDER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+
+enum class FlightOp : uint32_t { none, start, heartbeat, done };
+
+/*
+ * flight_entry -- single record of ring buffer. Argument holds milliseconds
+ * elapsed since start for heartbeat and result of the operation for done.
+ * Checksum is computed over remaining fields, so entries torn by power
+ * failure can be detected.
+ */
+struct flight_entry {
+  uint64_t seq;
+  uint64_t arg;
+  uint64_t timestamp;
+  uint32_t op;
+  uint32_t checksum;
+};
+
+/*
+ * flight_event -- decoded entry with timestamp converted to microseconds
+ * since the first recorded event.
+ */
+struct flight_event {
+  unsigned ring;
+  uint64_t seq;
+  FlightOp op;
+  uint64_t arg;
+  double time_us;
+  bool last_in_ring;
+};
+
+/*
+ * FlightRing -- ring buffer written by single thread. Entries are written
+ * with regular cached stores and flushed every FLUSH_INTERVAL entries, so
+ * only entries logged since last flush can be lost on power failure.
+ */
+class FlightRing final : NonCopyable {
+ private:
+  friend class FlightRecorder;
+  flight_entry *entries_;
+  uint64_t capacity_;
+  bool is_pmem_;
+  uint64_t seq_ = 0;
+  uint64_t flushed_ = 0;
+
+  FlightRing(flight_entry *entries, uint64_t capacity, bool is_pmem)
+      : entries_(entries), capacity_(capacity), is_pmem_(is_pmem) {
+  }
+  void Persist(const void *addr, size_t len) const;
+
+ public:
+  static const uint64_t FLUSH_INTERVAL = 32;
+
+  /*
+   * Log -- records operation of given type with given argument.
+   */
+  void Log(FlightOp op, uint64_t arg);
+
+  /*
+   * Flush -- makes all logged entries persistent.
+   */
+  void Flush();
+
+  ~FlightRing() {
+    Flush();
+  }
+};
+
+/*
+ * FlightRecorder -- class that keeps per-thread ring buffers of recently
+ * performed operations in persistent memory file, usually placed next to the
+ * pool used by test. Rings stay mapped as long as the logging process runs,
+ * so if it runs when unsafe shutdown is injected, the file decoded after the
+ * power cycle shows operations which were in flight at that moment.
+ */
+class FlightRecorder final : NonCopyable {
+ private:
+  void *addr_ = nullptr;
+  size_t mapped_len_ = 0;
+  bool is_pmem_ = false;
+  unsigned rings_ = 0;
+  uint64_t ring_entries_ = 0;
+  std::atomic<unsigned> next_ring_{0};
+
+ public:
+  /*
+   * Create -- creates file with given number of rings of given size and maps
+   * it. Returns 0 on success, prints error message and returns -1 otherwise.
+   */
+  int Create(const std::string &path, unsigned rings = 4,
+             uint64_t ring_entries = 4096);
+
+  /*
+   * GetRing -- claims unused ring for calling thread without locking. Returns
+   * nullptr if all rings are already claimed. Ring has to be destroyed before
+   * the recorder.
+   */
+  std::unique_ptr<FlightRing> GetRing();
+
+  /*
+   * Decode -- reads valid entries from all rings of given file into timeline
+   * sorted by timestamp. Returns 0 on success, prints error message and
+   * returns -1 otherwise.
+   */
+  static int Decode(const std::string &path,
+                    std::vector<flight_event> &timeline);
+
+  /*
+   * FormatTimeline -- returns given number of last events, one per line.
+   * Last event of every ring, i.e. the last persistent operation logged by
+   * its thread before it finished or was interrupted, is marked.
+   */
+  static std::string FormatTimeline(const std::vector<flight_event> &timeline,
+                                    size_t last_count);
+
+  static std::string ToString(FlightOp op);
+
+  ~FlightRecorder();
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_FLIGHT_RECORDER_H_
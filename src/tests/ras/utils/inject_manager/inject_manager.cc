@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2023, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -31,6 +31,7 @@
  */
 
 #include "inject_manager.h"
+#include <cctype>
 
 int InjectManager::ReadRecordedUSC(const std::string &usc_file_path) const {
   std::string content;
@@ -64,8 +65,44 @@ int InjectManager::RecordDimmUSC(const Dimm &dimm) const {
   return 0;
 }
 
+std::string InjectManager::GetPmem2USCFilePath(
+    const std::string &device_id) const {
+  std::string file_name{"pmem2_usc_" + device_id};
+  for (auto &c : file_name) {
+    if (!std::isalnum(static_cast<unsigned char>(c))) {
+      c = '_';
+    }
+  }
+  return test_dir_ + file_name;
+}
+
+int InjectManager::RecordNamespaceUSC(
+    const DimmNamespace &dimm_namespace) const {
+  pmem2_usc usc;
+  if (Pmem2Usc::ReadForDir(dimm_namespace.GetTestDir(), usc) != 0) {
+    std::cerr << "Reading USC of namespace with test dir "
+              << dimm_namespace.GetTestDir() << " failed" << std::endl;
+    return -1;
+  }
+
+  if (ApiC::CreateFileT(GetPmem2USCFilePath(usc.device_id),
+                        std::to_string(usc.usc)) == -1) {
+    return -1;
+  }
+  return 0;
+}
+
 int InjectManager::RecordUSC(
     const std::vector<DimmNamespace> &dimm_namespaces) const {
+  if (usc_backend_ == UscBackend::pmem2) {
+    for (const auto &dn : dimm_namespaces) {
+      if (RecordNamespaceUSC(dn) != 0) {
+        return -1;
+      }
+    }
+    return 0;
+  }
+
   for (const auto &dc : dimm_namespaces) {
     for (const auto &d : dc) {
       if (RecordDimmUSC(d) != 0) {
@@ -105,9 +142,40 @@ const std::vector<Dimm> InjectManager::GetDimmsToInject(
   return dimms;
 }
 
+bool InjectManager::CheckPmem2USCDiff(
+    const std::vector<DimmNamespace> &dimm_namespaces,
+    std::function<bool(int, int)> compare) const {
+  for (const auto &dn : dimm_namespaces) {
+    pmem2_usc usc;
+    if (Pmem2Usc::ReadForDir(dn.GetTestDir(), usc) != 0) {
+      return false;
+    }
+
+    int recorded_usc = ReadRecordedUSC(GetPmem2USCFilePath(usc.device_id));
+    if (recorded_usc == -1) {
+      std::cerr << "Could not read USC of device: " << usc.device_id
+                << " with test dir: " << dn.GetTestDir() << std::endl;
+      return false;
+    }
+
+    if (!compare(recorded_usc, static_cast<int>(usc.usc))) {
+      std::cerr << "Device: " << usc.device_id
+                << " (test dir: " << dn.GetTestDir()
+                << "). Current USC: " << usc.usc
+                << " Last recorded USC: " << recorded_usc << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 bool InjectManager::CheckUSCDiff(
     const std::vector<DimmNamespace> &dimm_namespaces,
     std::function<bool(int, int)> compare) const {
+  if (usc_backend_ == UscBackend::pmem2) {
+    return CheckPmem2USCDiff(dimm_namespaces, compare);
+  }
+
   for (const auto &dn : dimm_namespaces) {
     for (const auto &d : GetDimmsToInject(dn)) {
       int recorded_usc = ReadRecordedUSC(test_dir_ + d.GetUid());
@@ -130,7 +198,9 @@ bool InjectManager::CheckUSCDiff(
   return true;
 }
 
-InjectManager::InjectManager(std::string test_dir, std::string policy) {
+InjectManager::InjectManager(std::string test_dir, std::string policy,
+                             UscBackend usc_backend)
+    : usc_backend_(usc_backend) {
   std::map<std::string, InjectPolicy> string_reprs = {
       {"all", InjectPolicy::all},
       {"first", InjectPolicy::first},
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2023, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -35,18 +35,25 @@
 
 #include <functional>
 #include "dimm/dimm.h"
+#include "pmem2_usc/pmem2_usc.h"
 
 /* Select whether the unsafe shutdown error is injected into the first, last or
  * each dimm from specific dimm namespace */
 enum class InjectPolicy { all, first, last };
 
+/* Select whether unsafe shutdown count is read per DIMM with ndctl SMART
+ * command or per namespace through libpmem2, the same way PMDK reads it */
+enum class UscBackend { ndctl, pmem2 };
+
 class InjectManager {
  public:
-  InjectManager(std::string test_dir, InjectPolicy policy)
-      : test_dir_(test_dir), policy_(policy) {
+  InjectManager(std::string test_dir, InjectPolicy policy,
+                UscBackend usc_backend = UscBackend::ndctl)
+      : test_dir_(test_dir), policy_(policy), usc_backend_(usc_backend) {
   }
 
-  InjectManager(std::string test_dir, std::string policy);
+  InjectManager(std::string test_dir, std::string policy,
+                UscBackend usc_backend = UscBackend::ndctl);
 
   bool IsLastShutdownUnsafe(
       const std::vector<DimmNamespace> &dimm_namespaces) const;
@@ -58,12 +65,17 @@ class InjectManager {
  private:
   std::string test_dir_;
   InjectPolicy policy_;
+  UscBackend usc_backend_;
   bool CheckUSCDiff(const std::vector<DimmNamespace> &dimm_namespaces,
                     std::function<bool(int, int)> compare) const;
+  bool CheckPmem2USCDiff(const std::vector<DimmNamespace> &dimm_namespaces,
+                         std::function<bool(int, int)> compare) const;
 
   int ReadRecordedUSC(const std::string &usc_file_path) const;
 
   int RecordDimmUSC(const Dimm &dimm) const;
+  int RecordNamespaceUSC(const DimmNamespace &dimm_namespace) const;
+  std::string GetPmem2USCFilePath(const std::string &device_id) const;
   const std::vector<Dimm> GetDimmsToInject(
       const DimmNamespace &us_dimm_coll) const;
 };
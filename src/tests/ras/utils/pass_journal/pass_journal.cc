@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pass_journal.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include "api_c/api_c.h"
+
+int PassJournal::Load(const std::string &dir) {
+  path_ = GetPath(dir);
+  records_.clear();
+  pending_.clear();
+
+  if (!ApiC::RegularFileExists(path_)) {
+    return 0;
+  }
+
+  std::string content;
+  if (ApiC::ReadFile(path_, content) != 0) {
+    return -1;
+  }
+
+  std::istringstream lines{content};
+  std::string line;
+  while (std::getline(lines, line)) {
+    std::istringstream fields{line};
+    std::string result;
+    std::string test_name;
+    pass_record record;
+    if (!(fields >> record.phase >> result >> record.duration_ms) ||
+        !std::getline(fields >> std::ws, test_name) || test_name.empty()) {
+      /* line torn by unsafe shutdown during previous write is skipped */
+      std::cerr << "Skipping malformed line of " << path_ << ": " << line
+                << std::endl;
+      continue;
+    }
+    record.passed = result == "PASSED";
+    records_[std::make_pair(test_name, record.phase)] = record;
+  }
+
+  return 0;
+}
+
+void PassJournal::Record(const std::string &test_name,
+                         const pass_record &record) {
+  records_[std::make_pair(test_name, record.phase)] = record;
+  pending_ += std::to_string(record.phase) + "\t" +
+              (record.passed ? "PASSED" : "FAILED") + "\t" +
+              std::to_string(record.duration_ms) + "\t" + test_name + "\n";
+}
+
+bool PassJournal::Passed(const std::string &test_name, int phase) const {
+  auto search = records_.find(std::make_pair(test_name, phase));
+  return search != records_.end() && search->second.passed;
+}
+
+int PassJournal::Flush() {
+  if (pending_.empty()) {
+    return 0;
+  }
+  if (path_.empty()) {
+    std::cerr << "Pass journal was not loaded" << std::endl;
+    return -1;
+  }
+
+  /* O_APPEND lets worker processes of the same phase share the journal */
+  int fd = open(path_.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+  if (fd == -1) {
+    std::cerr << "Opening " << path_ << " failed: " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  int ret = 0;
+  ssize_t written = write(fd, pending_.data(), pending_.size());
+  if (written != static_cast<ssize_t>(pending_.size()) || fsync(fd) != 0) {
+    std::cerr << "Writing " << path_ << " failed: " << std::strerror(errno)
+              << std::endl;
+    ret = -1;
+  } else {
+    pending_.clear();
+  }
+
+  close(fd);
+  return ret;
+}
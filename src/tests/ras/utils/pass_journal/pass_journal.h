@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_PASS_JOURNAL_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_PASS_JOURNAL_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * pass_record -- result of single test in given phase.
+ */
+struct pass_record {
+  int phase = 0;
+  bool passed = false;
+  long long duration_ms = 0;
+};
+
+/*
+ * PassJournal -- class that keeps results of tests from all phases in single
+ * append-only file in test directory. Journal is read once before running
+ * tests, results of current phase are buffered and appended with single
+ * write and fsync at the end of the phase. Every line holds phase number,
+ * result, duration and test name separated with tabs.
+ */
+class PassJournal final : NonCopyable {
+ private:
+  std::string path_;
+  std::map<std::pair<std::string, int>, pass_record> records_;
+  std::string pending_;
+  PassJournal() = default;
+
+ public:
+  static PassJournal &GetInstance() {
+    static PassJournal pass_journal;
+    return pass_journal;
+  }
+
+  /*
+   * GetPath -- returns path of journal kept in given directory.
+   */
+  static std::string GetPath(const std::string &dir) {
+    return dir + "pass_journal";
+  }
+
+  /*
+   * Load -- reads journal from given directory. Missing journal is treated as
+   * empty one. Returns 0 on success, prints error message and returns -1
+   * otherwise.
+   */
+  int Load(const std::string &dir);
+
+  /*
+   * Record -- adds result of the test to the journal. Result is written to
+   * the file by Flush().
+   */
+  void Record(const std::string &test_name, const pass_record &record);
+
+  /*
+   * Passed -- returns true if the latest result of given test in given phase
+   * is pass.
+   */
+  bool Passed(const std::string &test_name, int phase) const;
+
+  /*
+   * Flush -- appends results recorded since last flush to the journal file
+   * and synchronizes it with storage. Returns 0 on success, prints error
+   * message and returns -1 otherwise.
+   */
+  int Flush();
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_PASS_JOURNAL_H_
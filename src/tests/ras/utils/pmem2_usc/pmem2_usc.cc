@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pmem2_usc.h"
+#include <fcntl.h>
+#include <libpmem2.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include "api_c/api_c.h"
+
+const std::string PROBE_FILE_NAME = "pmem2_usc_probe";
+
+namespace {
+int ReadSource(const struct pmem2_source *src, pmem2_usc &usc) {
+  size_t len = 0;
+  if (pmem2_source_device_id(src, nullptr, &len) != 0) {
+    return -1;
+  }
+
+  std::vector<char> id(len);
+  if (pmem2_source_device_id(src, id.data(), &len) != 0 ||
+      pmem2_source_device_usc(src, &usc.usc) != 0) {
+    return -1;
+  }
+  usc.device_id = id.data();
+  return 0;
+}
+}  // namespace
+
+int Pmem2Usc::Read(const std::string &file_path, pmem2_usc &usc) {
+  int fd = open(file_path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    std::cerr << "Cannot open " << file_path << ": " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  struct pmem2_source *src = nullptr;
+  int ret = pmem2_source_from_fd(&src, fd);
+  if (ret == 0) {
+    ret = ReadSource(src, usc);
+    pmem2_source_delete(&src);
+  }
+  close(fd);
+
+  if (ret != 0) {
+    std::cerr << "Reading USC of " << file_path
+              << " failed: " << pmem2_errormsg() << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+int Pmem2Usc::ReadForDir(const std::string &dir, pmem2_usc &usc) {
+  std::string probe_path = dir + PROBE_FILE_NAME;
+  if (!ApiC::RegularFileExists(probe_path) &&
+      ApiC::CreateFileT(probe_path, "") != 0) {
+    return -1;
+  }
+  return Read(probe_path, usc);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_PMEM2_USC_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_PMEM2_USC_H_
+
+#include <cstdint>
+#include <string>
+#include "non_copyable/non_copyable.h"
+
+/*
+ * pmem2_usc -- unsafe shutdown count and id of the device backing a file, as
+ * seen by libpmem2. For files on interleaved namespaces 'usc' is the sum of
+ * unsafe shutdown counts of all DIMMs in the interleave set.
+ */
+struct pmem2_usc {
+  std::string device_id;
+  uint64_t usc = 0;
+};
+
+/*
+ * Pmem2Usc -- reads unsafe shutdown count through pmem2_source_device_usc()
+ * and pmem2_source_device_id(). Unlike ndctl SMART commands it does not walk
+ * ndctl buses and works per file.
+ */
+class Pmem2Usc final : NonCopyable {
+ public:
+  /*
+   * Read -- reads device id and unsafe shutdown count of the device backing
+   * given file. Returns 0 on success, prints error message and returns -1
+   * otherwise.
+   */
+  static int Read(const std::string &file_path, pmem2_usc &usc);
+
+  /*
+   * ReadForDir -- same as Read(), for device backing given directory. Probe
+   * file is created in the directory if it does not exist.
+   */
+  static int ReadForDir(const std::string &dir, pmem2_usc &usc);
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_PMEM2_USC_H_
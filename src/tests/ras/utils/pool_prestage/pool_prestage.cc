@@ -0,0 +1,296 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pool_prestage.h"
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <sstream>
+#include "api_c/api_c.h"
+#include "timer/timer.h"
+
+bool PoolPrestage::MatchesPattern(const char *pattern, const char *name) {
+  switch (*pattern) {
+    case '\0':
+    case ':':
+      return *name == '\0';
+    case '?':
+      return *name != '\0' && MatchesPattern(pattern + 1, name + 1);
+    case '*':
+      return (*name != '\0' && MatchesPattern(pattern, name + 1)) ||
+             MatchesPattern(pattern + 1, name);
+    default:
+      return *pattern == *name && MatchesPattern(pattern + 1, name + 1);
+  }
+}
+
+bool PoolPrestage::MatchesFilter(const std::string &name,
+                                 const std::string &filter) {
+  /* gtest filter syntax: POSITIVE_PATTERNS[-NEGATIVE_PATTERNS] */
+  size_t dash = filter.find('-');
+  std::string positive = filter.substr(0, dash);
+  std::string negative =
+      dash == std::string::npos ? "" : filter.substr(dash + 1);
+  if (positive.empty()) {
+    positive = "*";
+  }
+
+  auto matches_any = [&name](const std::string &patterns) {
+    const char *pattern = patterns.c_str();
+    while (*pattern != '\0') {
+      if (MatchesPattern(pattern, name.c_str())) {
+        return true;
+      }
+      pattern = std::strchr(pattern, ':');
+      if (pattern == nullptr) {
+        return false;
+      }
+      ++pattern;
+    }
+    return false;
+  };
+
+  return matches_any(positive) && !matches_any(negative);
+}
+
+std::vector<prestaged_pool> PoolPrestage::Plan() const {
+  std::vector<prestaged_pool> pools;
+  const std::string filter = ::testing::GTEST_FLAG(filter);
+  ::testing::UnitTest *ut = ::testing::UnitTest::GetInstance();
+
+  for (int i = 0; i < ut->total_test_case_count(); ++i) {
+    const ::testing::TestCase *test_case = ut->GetTestCase(i);
+    std::string fixture = test_case->name();
+    fixture = fixture.substr(fixture.rfind('/') + 1);
+    auto planner = planners_.find(fixture);
+    if (planner == planners_.end()) {
+      continue;
+    }
+
+    for (int j = 0; j < test_case->total_test_count(); ++j) {
+      const ::testing::TestInfo *test_info = test_case->GetTestInfo(j);
+      std::string name =
+          std::string{test_case->name()} + "." + test_info->name();
+      if (name.find("DISABLED_") != std::string::npos ||
+          !MatchesFilter(name, filter)) {
+        continue;
+      }
+      for (const auto &pool : planner->second(*test_info)) {
+        pools.emplace_back(pool);
+      }
+    }
+  }
+
+  return pools;
+}
+
+int PoolPrestage::CreateFiles(const std::vector<prestaged_pool> &pools) {
+  for (const auto &pool : pools) {
+    int fd = open(pool.path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (fd == -1) {
+      std::cerr << "Creating " << pool.path
+                << " failed: " << std::strerror(errno) << std::endl;
+      return -1;
+    }
+    int ret = posix_fallocate(fd, 0, static_cast<off_t>(pool.size));
+    close(fd);
+    if (ret != 0) {
+      std::cerr << "Allocating " << pool.path
+                << " failed: " << std::strerror(ret) << std::endl;
+      ApiC::RemoveFile(pool.path);
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int PoolPrestage::Run(const std::vector<prestaged_pool> &pools,
+                      const std::string &dir) {
+  std::map<std::string, std::vector<prestaged_pool>> dirs;
+  std::ostringstream manifest;
+  size_t total_size = 0;
+  for (const auto &pool : pools) {
+    dirs[pool.path.substr(0, pool.path.rfind('/') + 1)].emplace_back(pool);
+    manifest << pool.size << "\t" << pool.path << "\n";
+    total_size += pool.size;
+  }
+
+  Timer timer;
+  timer.Start();
+  std::vector<std::future<int>> workers;
+  for (const auto &it : dirs) {
+    workers.emplace_back(
+        std::async(std::launch::async, CreateFiles, std::cref(it.second)));
+  }
+  int ret = 0;
+  for (auto &worker : workers) {
+    if (worker.get() != 0) {
+      ret = -1;
+    }
+  }
+  timer.Stop();
+
+  if (ret != 0 || ApiC::CreateFileT(GetManifestPath(dir),
+                                    manifest.str()) != 0) {
+    return -1;
+  }
+  if (!pools.empty()) {
+    std::cout << "Prestaged " << pools.size() << " pools ("
+              << total_size / (1024 * 1024) << " MiB) in " << dirs.size()
+              << " directories in " << timer.GetElapsed() << " ms"
+              << std::endl;
+  }
+  return Load(dir);
+}
+
+int PoolPrestage::Load(const std::string &dir) {
+  pools_.clear();
+  std::string path = GetManifestPath(dir);
+  if (!ApiC::RegularFileExists(path)) {
+    return 0;
+  }
+
+  std::string content;
+  if (ApiC::ReadFile(path, content) != 0) {
+    return -1;
+  }
+  std::istringstream lines{content};
+  size_t size;
+  std::string pool_path;
+  while (lines >> size && std::getline(lines >> std::ws, pool_path)) {
+    pools_[pool_path] = size;
+  }
+  return 0;
+}
+
+bool PoolPrestage::Take(const std::string &path, size_t size) {
+  auto search = pools_.find(path);
+  if (search == pools_.end()) {
+    return false;
+  }
+
+  bool ret = search->second == size;
+  pools_.erase(search);
+  if (ret) {
+    ++hits_;
+  } else {
+    ApiC::RemoveFile(path);
+  }
+  return ret;
+}
+
+int PoolPrestage::CloneFile(const std::string &src, const std::string &dest) {
+  int src_fd = open(src.c_str(), O_RDONLY);
+  if (src_fd == -1) {
+    std::cerr << "Cannot open " << src << ": " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+  int dest_fd = open(dest.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+  if (dest_fd == -1) {
+    std::cerr << "Cannot create " << dest << ": " << std::strerror(errno)
+              << std::endl;
+    close(src_fd);
+    return -1;
+  }
+
+  int ret = ioctl(dest_fd, FICLONE, src_fd);
+  int err = errno;
+  close(dest_fd);
+  close(src_fd);
+  if (ret != 0) {
+    ApiC::RemoveFile(dest);
+    errno = err;
+  }
+  return ret;
+}
+
+int PoolPrestage::Clone(const std::string &path, size_t size) {
+  std::string dir = path.substr(0, path.rfind('/') + 1);
+  auto key = std::make_pair(dir, size);
+  auto search = templates_.find(key);
+  Timer timer;
+
+  if (search == templates_.end()) {
+    /* template name is unique per process, as workers run in parallel */
+    std::string template_path = dir + ".prestage_template_" +
+                                std::to_string(size) + "_" +
+                                std::to_string(getpid());
+    timer.Start();
+    if (CreateFiles({{template_path, size}}) != 0) {
+      template_path.clear();
+    }
+    timer.Stop();
+    template_time_ms_ += timer.GetElapsed();
+    search = templates_.emplace(key, template_path).first;
+  }
+
+  if (!search->second.empty()) {
+    timer.Start();
+    if (CloneFile(search->second, path) == 0) {
+      timer.Stop();
+      clone_time_ms_ += timer.GetElapsed();
+      ++clones_;
+      return 0;
+    }
+    if (errno == EOPNOTSUPP || errno == EXDEV || errno == EINVAL ||
+        errno == ENOTTY) {
+      /* no reflink support, do not retry for this template */
+      ApiC::RemoveFile(search->second);
+      search->second.clear();
+    }
+  }
+
+  ++misses_;
+  return -1;
+}
+
+void PoolPrestage::RemoveTemplates() {
+  for (auto &it : templates_) {
+    if (!it.second.empty()) {
+      ApiC::RemoveFile(it.second);
+    }
+  }
+  templates_.clear();
+}
+
+std::string PoolPrestage::GetStatistics() const {
+  std::ostringstream stats;
+  stats << "prestaged: " << hits_ << ", cloned: " << clones_ << " in "
+        << clone_time_ms_ << " ms, created: " << misses_ << ", templates: "
+        << templates_.size() << " in " << template_time_ms_ << " ms";
+  return stats.str();
+}
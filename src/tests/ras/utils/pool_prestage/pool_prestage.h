@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_POOL_PRESTAGE_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_POOL_PRESTAGE_H_
+
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+#include "non_copyable/non_copyable.h"
+
+/*
+ * prestaged_pool -- path and size of pool file created before running tests.
+ */
+struct prestaged_pool {
+  std::string path;
+  size_t size;
+};
+
+/*
+ * PrestagePlanner -- function returning pools created by given test.
+ */
+typedef std::function<std::vector<prestaged_pool>(const ::testing::TestInfo &)>
+    PrestagePlanner;
+
+/*
+ * PoolPrestage -- class that creates files of pools needed by tests selected
+ * by --gtest_filter before the tests are run, in parallel, one thread per
+ * directory (namespace). Tests of fixtures which registered PrestagePlanner
+ * take prestaged files instead of allocating them. Files are preallocated,
+ * but not initialized, as pools have to be created by tests with their own
+ * pool settings. List of prestaged files is kept in manifest file, so it can
+ * be read by worker processes. Files of pools which were not prestaged are
+ * cloned with FICLONE from preallocated template file, one per directory and
+ * pool size, where file system supports reflinks.
+ */
+class PoolPrestage final : NonCopyable {
+ private:
+  std::map<std::string, PrestagePlanner> planners_;
+  std::map<std::string, size_t> pools_;
+  /* template paths by directory and size, empty if reflinks are unsupported */
+  std::map<std::pair<std::string, size_t>, std::string> templates_;
+  size_t hits_ = 0;
+  size_t clones_ = 0;
+  size_t misses_ = 0;
+  double clone_time_ms_ = 0;
+  double template_time_ms_ = 0;
+  PoolPrestage() = default;
+
+  static bool MatchesPattern(const char *pattern, const char *name);
+  static bool MatchesFilter(const std::string &name,
+                            const std::string &filter);
+  static int CreateFiles(const std::vector<prestaged_pool> &pools);
+  static int CloneFile(const std::string &src, const std::string &dest);
+
+ public:
+  static PoolPrestage &GetInstance() {
+    static PoolPrestage pool_prestage;
+    return pool_prestage;
+  }
+
+  /*
+   * Registrar -- registers planner of given fixture on construction, meant to
+   * be defined at namespace scope next to tests.
+   */
+  class Registrar {
+   public:
+    Registrar(const std::string &fixture, PrestagePlanner planner) {
+      PoolPrestage::GetInstance().planners_[fixture] = planner;
+    }
+  };
+
+  static std::string GetManifestPath(const std::string &dir) {
+    return dir + "prestaged_pools";
+  }
+
+  /*
+   * Plan -- returns pools needed by tests selected by --gtest_filter flag,
+   * collected from planners of their fixtures.
+   */
+  std::vector<prestaged_pool> Plan() const;
+
+  /*
+   * Run -- creates files of given pools and saves their list in manifest in
+   * given directory. Returns 0 on success, prints error message and returns
+   * -1 otherwise.
+   */
+  int Run(const std::vector<prestaged_pool> &pools, const std::string &dir);
+
+  /*
+   * Load -- reads list of prestaged files from manifest in given directory.
+   * Missing manifest is treated as empty one. Returns 0 on success, -1
+   * otherwise.
+   */
+  int Load(const std::string &dir);
+
+  /*
+   * Take -- returns true if file of given size was prestaged in given path.
+   * File of different size is removed. Each file can be taken once.
+   */
+  bool Take(const std::string &path, size_t size);
+
+  /*
+   * Clone -- creates file of given size in given path as FICLONE reflink of
+   * preallocated template placed in the same directory. Template is created
+   * on first use. Returns 0 on success, -1 if file system does not support
+   * reflinks or cloning failed, so pool has to be created regularly.
+   */
+  int Clone(const std::string &path, size_t size);
+
+  /*
+   * RemoveTemplates -- removes template files created by Clone().
+   */
+  void RemoveTemplates();
+
+  /*
+   * GetStatistics -- returns counts of prestaged, cloned and regularly
+   * created pools with time spent on cloning and creating templates.
+   */
+  std::string GetStatistics() const;
+
+  size_t GetRequests() const {
+    return hits_ + clones_ + misses_;
+  }
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_POOL_PRESTAGE_H_
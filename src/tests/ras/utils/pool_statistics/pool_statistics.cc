@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pool_statistics.h"
+#include <cstdlib>
+#include <sstream>
+#include "api_c/api_c.h"
+#include "string_utils.h"
+
+int PoolStatistics::Enable() {
+  const std::string stats_enabled{"stats.enabled=1"};
+  const char *conf = std::getenv("PMEMOBJ_CONF");
+  std::string value{stats_enabled};
+
+  if (conf != nullptr && *conf != '\0') {
+    if (string_utils::IsSubstrFound(stats_enabled, std::string{conf})) {
+      return 0;
+    }
+    value = std::string{conf} + ";" + stats_enabled;
+  }
+
+  return ApiC::SetEnv("PMEMOBJ_CONF", value);
+}
+
+int PoolStatistics::Read(PMEMobjpool *pop, pool_statistics &stats) {
+  if (pmemobj_ctl_get(pop, "stats.heap.curr_allocated",
+                      &stats.curr_allocated) != 0 ||
+      pmemobj_ctl_get(pop, "stats.heap.run_allocated",
+                      &stats.run_allocated) != 0 ||
+      pmemobj_ctl_get(pop, "stats.heap.run_active", &stats.run_active) != 0) {
+    std::cerr << "Reading pool statistics failed: " << pmemobj_errormsg()
+              << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+std::string PoolStatistics::GetOutputPath(const std::string &phase_name,
+                                          const std::string &output) {
+  const std::string suffix{"_pool_stats.csv"};
+
+  if (output.compare(0, 3, "xml") != 0) {
+    return "";
+  }
+
+  std::string path = output.size() > 4 ? output.substr(4) : "";
+  if (path.empty()) {
+    return "test_detail" + suffix;
+  }
+  if (path.back() == '/') {
+    return path + phase_name + suffix;
+  }
+
+  size_t ext = path.rfind(".xml");
+  if (ext != std::string::npos && ext == path.size() - 4) {
+    path.erase(ext);
+  }
+  return path + suffix;
+}
+
+int PoolStatistics::Save(const std::string &phase_name) const {
+  std::string path = GetOutputPath(phase_name);
+  if (path.empty()) {
+    return 0;
+  }
+
+  std::ostringstream content;
+  content << "test_name,phase,curr_allocated,run_allocated,run_active\n";
+  for (const auto &r : records_) {
+    content << r.test_name << "," << r.phase_name << "," << r.curr_allocated
+            << "," << r.run_allocated << "," << r.run_active << "\n";
+  }
+
+  return ApiC::CreateFileT(path, content.str());
+}
+
+int PoolStatistics::Merge(const std::vector<std::string> &paths,
+                          const std::string &output_path) {
+  std::string merged;
+  for (const auto &path : paths) {
+    if (!ApiC::RegularFileExists(path)) {
+      continue;
+    }
+    if (output_path.empty()) {
+      ApiC::RemoveFile(path);
+      continue;
+    }
+    std::string content;
+    if (ApiC::ReadFile(path, content) != 0) {
+      return -1;
+    }
+    /* keep header line of the first file only */
+    size_t start = 0;
+    if (!merged.empty()) {
+      start = content.find('\n');
+      start = start == std::string::npos ? content.size() : start + 1;
+    }
+    merged.append(content, start, std::string::npos);
+    ApiC::RemoveFile(path);
+  }
+
+  if (merged.empty()) {
+    return 0;
+  }
+  return ApiC::CreateFileT(output_path, merged);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_POOL_STATISTICS_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_POOL_STATISTICS_H_
+
+#include <libpmemobj.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "non_copyable/non_copyable.h"
+
+struct pool_statistics {
+  std::string test_name;
+  std::string phase_name;
+  uint64_t curr_allocated = 0;
+  uint64_t run_allocated = 0;
+  uint64_t run_active = 0;
+};
+
+/*
+ * PoolStatistics -- class that collects pmemobj heap statistics of pools used
+ * by tests and saves them in CSV file placed next to gtest XML output.
+ */
+class PoolStatistics final : NonCopyable {
+ private:
+  std::vector<pool_statistics> records_;
+  PoolStatistics() = default;
+
+ public:
+  static PoolStatistics &GetInstance() {
+    static PoolStatistics pool_statistics;
+    return pool_statistics;
+  }
+
+  /*
+   * Enable -- enables statistics in all pools created or opened by the process
+   * by appending 'stats.enabled' to PMEMOBJ_CONF environment variable.
+   * Returns 0 on success, -1 otherwise.
+   */
+  static int Enable();
+
+  /*
+   * Read -- reads heap statistics of given pool. Returns 0 on success, prints
+   * error message and returns -1 otherwise.
+   */
+  static int Read(PMEMobjpool *pop, pool_statistics &stats);
+
+  /*
+   * GetOutputPath -- returns path of statistics file derived from
+   * --gtest_output flag, e.g. "phase1_pool_stats.csv" for "xml:phase1.xml".
+   * Returns empty string if XML output is not requested.
+   */
+  static std::string GetOutputPath(const std::string &phase_name) {
+    return GetOutputPath(phase_name, ::testing::GTEST_FLAG(output));
+  }
+  static std::string GetOutputPath(const std::string &phase_name,
+                                   const std::string &output);
+
+  /*
+   * Merge -- concatenates statistics files saved by worker processes into
+   * single file and removes them. Missing files are skipped, empty output
+   * path discards statistics. Returns 0 on success, -1 otherwise.
+   */
+  static int Merge(const std::vector<std::string> &paths,
+                   const std::string &output_path);
+
+  void Add(const pool_statistics &stats) {
+    records_.emplace_back(stats);
+  }
+
+  /*
+   * Save -- writes collected statistics to CSV file given by GetOutputPath().
+   * Returns 0 on success or when no file is requested, -1 otherwise.
+   */
+  int Save(const std::string &phase_name) const;
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_POOL_STATISTICS_H_
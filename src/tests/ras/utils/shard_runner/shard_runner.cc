@@ -0,0 +1,246 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "shard_runner.h"
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "api_c/api_c.h"
+#include "exit_codes.h"
+#include "gtest/gtest.h"
+
+namespace {
+const std::string WORKER_ENV{"PMDK_TESTS_SHARD_WORKER"};
+}
+
+ShardRunner::ShardRunner(unsigned shards, int argc, char **argv)
+    : shards_(shards), args_(argv, argv + argc) {
+  std::string output = ::testing::GTEST_FLAG(output);
+  xml_requested_ = output.compare(0, 3, "xml") == 0;
+
+  std::string path = xml_requested_ && output.size() > 4 ? output.substr(4)
+                                                         : "";
+  if (path.empty()) {
+    xml_path_ = "test_detail.xml";
+  } else if (path.back() == '/') {
+    size_t pos = args_.front().rfind('/');
+    xml_path_ = path +
+                args_.front().substr(pos == std::string::npos ? 0 : pos + 1) +
+                ".xml";
+  } else {
+    xml_path_ = path;
+  }
+}
+
+bool ShardRunner::IsWorker() {
+  return std::getenv(WORKER_ENV.c_str()) != nullptr;
+}
+
+std::string ShardRunner::GetShardOutput(unsigned index) const {
+  std::string path = xml_path_;
+  size_t ext = path.rfind(".xml");
+  if (ext != std::string::npos && ext == path.size() - 4) {
+    path.erase(ext);
+  }
+  return "xml:" + path + ".shard" + std::to_string(index) + ".xml";
+}
+
+pid_t ShardRunner::StartWorker(unsigned index) const {
+  std::vector<std::string> args{args_};
+  args.emplace_back("--gtest_filter=" + ::testing::GTEST_FLAG(filter));
+  args.emplace_back("--gtest_output=" + GetShardOutput(index));
+  args.emplace_back("--gtest_color=" + ::testing::GTEST_FLAG(color));
+
+  std::vector<char *> argv;
+  for (auto &arg : args) {
+    argv.emplace_back(&arg[0]);
+  }
+  argv.emplace_back(nullptr);
+
+  pid_t pid = fork();
+  if (pid != 0) {
+    return pid;
+  }
+
+  if (ApiC::SetEnv(WORKER_ENV, std::to_string(index)) == 0 &&
+      ApiC::SetEnv("GTEST_TOTAL_SHARDS", std::to_string(shards_)) == 0 &&
+      ApiC::SetEnv("GTEST_SHARD_INDEX", std::to_string(index)) == 0) {
+    execv("/proc/self/exe", argv.data());
+    std::cerr << "Starting worker " << index
+              << " failed: " << std::strerror(errno) << std::endl;
+  }
+  _exit(1);
+}
+
+int ShardRunner::Run() {
+  std::vector<pid_t> pids;
+  std::vector<std::string> paths;
+
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+  for (unsigned i = 0; i < shards_; ++i) {
+    pid_t pid = StartWorker(i);
+    if (pid == -1) {
+      std::cerr << "fork failed: " << std::strerror(errno) << std::endl;
+      break;
+    }
+    pids.emplace_back(pid);
+    paths.emplace_back(GetShardOutput(i).substr(4));
+  }
+
+  for (size_t i = 0; i < pids.size(); ++i) {
+    int status;
+    if (waitpid(pids[i], &status, 0) == -1 || !WIFEXITED(status)) {
+      std::cerr << "Worker " << i << " terminated abnormally" << std::endl;
+    }
+  }
+
+  if (MergeXml(paths) != 0) {
+    return 1;
+  }
+  for (const auto &path : paths) {
+    ApiC::RemoveFile(path);
+  }
+
+  /* tests of workers that failed to start are considered failed */
+  result_.failed += shards_ - static_cast<unsigned>(pids.size());
+  if (result_.failed == 0) {
+    return 0;
+  }
+  return result_.successful > 0 ? exit_codes::partially_passed : 1;
+}
+
+void ShardRunner::MergeTestCase(pugi::xml_node &root,
+                                const pugi::xml_node &suite,
+                                const pugi::xml_node &test_case) const {
+  const char *suite_name = suite.attribute("name").value();
+  const char *name = test_case.attribute("name").value();
+
+  pugi::xml_node merged_suite =
+      root.find_child_by_attribute("testsuite", "name", suite_name);
+  if (merged_suite.empty()) {
+    merged_suite = root.append_child("testsuite");
+    for (auto &&attr : suite.attributes()) {
+      merged_suite.append_copy(attr);
+    }
+  }
+
+  pugi::xml_node merged =
+      merged_suite.find_child_by_attribute("testcase", "name", name);
+  if (merged.empty()) {
+    merged_suite.append_copy(test_case);
+  } else if (std::string{test_case.attribute("status").value()} == "run") {
+    /* test was run by this worker and skipped as out of shard by others */
+    merged_suite.insert_copy_after(test_case, merged);
+    merged_suite.remove_child(merged);
+  }
+}
+
+void ShardRunner::CountResults(pugi::xml_node &root) {
+  int root_tests = 0;
+  int root_failures = 0;
+
+  for (auto &&suite : root.children("testsuite")) {
+    int tests = 0;
+    int failures = 0;
+    double time = 0;
+    for (auto &&test_case : suite.children("testcase")) {
+      ++tests;
+      if (std::string{test_case.attribute("status").value()} != "run") {
+        continue;
+      }
+      time += test_case.attribute("time").as_double();
+      if (test_case.child("failure").empty()) {
+        ++result_.successful;
+      } else {
+        ++result_.failed;
+        ++failures;
+      }
+    }
+    suite.attribute("tests").set_value(tests);
+    suite.attribute("failures").set_value(failures);
+    suite.attribute("time").set_value(time);
+    root_tests += tests;
+    root_failures += failures;
+  }
+  root.attribute("tests").set_value(root_tests);
+  root.attribute("failures").set_value(root_failures);
+}
+
+int ShardRunner::MergeXml(const std::vector<std::string> &paths) {
+  pugi::xml_document merged;
+  pugi::xml_node root;
+  double time = 0;
+
+  for (size_t i = 0; i < paths.size(); ++i) {
+    pugi::xml_document doc;
+    if (!doc.load_file(paths[i].c_str())) {
+      std::cerr << "Cannot read output of worker " << i << ": " << paths[i]
+                << std::endl;
+      ++result_.failed;
+      continue;
+    }
+    pugi::xml_node shard_root = doc.child("testsuites");
+    double shard_time = shard_root.attribute("time").as_double();
+    time = shard_time > time ? shard_time : time;
+
+    if (root.empty()) {
+      root = merged.append_copy(shard_root);
+      continue;
+    }
+    for (auto &&suite : shard_root.children("testsuite")) {
+      for (auto &&test_case : suite.children("testcase")) {
+        MergeTestCase(root, suite, test_case);
+      }
+    }
+  }
+
+  if (root.empty()) {
+    return 0;
+  }
+
+  /* workers run in parallel, so phase takes as long as the slowest one */
+  root.attribute("time").set_value(time);
+  CountResults(root);
+
+  if (xml_requested_ && !merged.save_file(xml_path_.c_str(), "  ")) {
+    std::cerr << "Saving merged XML output to " << xml_path_ << " failed"
+              << std::endl;
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_SHARD_RUNNER_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_SHARD_RUNNER_H_
+
+#include <sys/types.h>
+#include <string>
+#include <vector>
+#include "non_copyable/non_copyable.h"
+#include "pugixml.hpp"
+
+/*
+ * shard_result -- numbers of tests run by all worker processes.
+ */
+struct shard_result {
+  int successful = 0;
+  int failed = 0;
+};
+
+/*
+ * ShardRunner -- class that divides tests selected by --gtest_filter between
+ * worker processes. Every worker re-executes the binary with
+ * GTEST_TOTAL_SHARDS and GTEST_SHARD_INDEX set, so it runs only its own shard
+ * of tests and skips pre- and post-test actions, which are run once by the
+ * parent process. XML outputs of workers are merged into file requested by
+ * --gtest_output flag.
+ */
+class ShardRunner final : NonCopyable {
+ private:
+  unsigned shards_;
+  std::vector<std::string> args_;
+  std::string xml_path_;
+  bool xml_requested_ = false;
+  shard_result result_;
+
+  pid_t StartWorker(unsigned index) const;
+  int MergeXml(const std::vector<std::string> &paths);
+  void MergeTestCase(pugi::xml_node &root, const pugi::xml_node &suite,
+                     const pugi::xml_node &test_case) const;
+  void CountResults(pugi::xml_node &root);
+
+ public:
+  /*
+   * ShardRunner -- constructor, takes arguments left by InitGoogleTest(), i.e.
+   * program name and test phase arguments.
+   */
+  ShardRunner(unsigned shards, int argc, char **argv);
+
+  /*
+   * IsWorker -- returns true if the process was started by ShardRunner.
+   */
+  static bool IsWorker();
+
+  /*
+   * GetShardOutput -- returns --gtest_output flag value passed to worker with
+   * given index.
+   */
+  std::string GetShardOutput(unsigned index) const;
+
+  unsigned GetShards() const {
+    return shards_;
+  }
+
+  /*
+   * Run -- starts all workers, waits for them and merges their XML outputs.
+   * Returns 0 if all tests passed, exit_codes::partially_passed if some of
+   * them failed and 1 if all tests failed or any worker crashed without
+   * reporting results.
+   */
+  int Run();
+
+  const shard_result &GetResult() const {
+    return result_;
+  }
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_SHARD_RUNNER_H_
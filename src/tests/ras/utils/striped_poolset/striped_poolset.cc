@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "striped_poolset.h"
+#include <stdexcept>
+#include "constants.h"
+#include "poolset/poolset_builder.h"
+
+Poolset StripedPoolset::Generate(const std::vector<std::string> &dirs,
+                                 const std::string &name, size_t pool_size,
+                                 size_t part_size,
+                                 const std::vector<PoolsetOption> &options) {
+  const size_t PART_ALIGNMENT = 2 * MEBIBYTE;
+  if (dirs.empty()) {
+    throw std::invalid_argument("No directories given for " + name);
+  }
+  if (part_size == 0 || part_size % PART_ALIGNMENT != 0 ||
+      pool_size % part_size != 0) {
+    throw std::invalid_argument("Invalid part size " +
+                                std::to_string(part_size) + " for pool of " +
+                                std::to_string(pool_size) + " bytes");
+  }
+
+  PoolsetBuilder builder{dirs.front(), name + ".set"};
+  for (const auto option : options) {
+    builder.AddOption(option);
+  }
+  return builder.AddReplica()
+      .AddParts(pool_size / part_size, part_size / MEBIBYTE, SizeUnit::mib,
+                dirs, name)
+      .Build();
+}
+
+Poolset StripedPoolset::Generate(const std::vector<DimmNamespace> &namespaces,
+                                 const std::string &name, size_t pool_size,
+                                 size_t part_size,
+                                 const std::vector<PoolsetOption> &options) {
+  std::vector<std::string> dirs;
+  for (const auto &dn : namespaces) {
+    dirs.emplace_back(dn.GetTestDir());
+  }
+  return Generate(dirs, name, pool_size, part_size, options);
+}
+
+Poolset StripedPoolset::GenerateDirectories(
+    const std::vector<std::string> &dirs, const std::string &name,
+    size_t pool_size) {
+  if (dirs.empty()) {
+    throw std::invalid_argument("No directories given for " + name);
+  }
+
+  PoolsetBuilder builder{dirs.front(), name + ".set"};
+  builder.AddReplica();
+  for (const auto &dir : dirs) {
+    builder.AddDirectoryPart(pool_size / dirs.size() / MEBIBYTE, SizeUnit::mib,
+                             dir + name + "/");
+  }
+  return builder.Build();
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_RAS_UTILS_STRIPED_POOLSET_H_
+#define PMDK_TESTS_SRC_RAS_UTILS_STRIPED_POOLSET_H_
+
+#include <string>
+#include <vector>
+#include "dimm/dimm.h"
+#include "poolset/poolset.h"
+
+/*
+ * StripedPoolset -- generator of poolsets with single replica split into
+ * equal parts placed round-robin across given namespaces: part 0 on the first
+ * namespace, part 1 on the second one and so on. Pool set file is placed in
+ * the first namespace.
+ */
+class StripedPoolset final {
+ public:
+  /*
+   * Generate -- returns poolset 'name' of 'pool_size' bytes split into parts
+   * of 'part_size' bytes named "<name>.part<index>", with given options. Part
+   * size has to be a multiple of 2 MiB and pool size a multiple of part size.
+   * Throws std::invalid_argument otherwise or if no directory is given.
+   */
+  static Poolset Generate(const std::vector<std::string> &dirs,
+                          const std::string &name, size_t pool_size,
+                          size_t part_size,
+                          const std::vector<PoolsetOption> &options = {});
+  static Poolset Generate(const std::vector<DimmNamespace> &namespaces,
+                          const std::string &name, size_t pool_size,
+                          size_t part_size,
+                          const std::vector<PoolsetOption> &options = {});
+
+  /*
+   * GenerateDirectories -- returns poolset 'name' with directory parts
+   * "<dir><name>/", one per given directory, reserving 'pool_size' bytes in
+   * total. Directories have to be created before the pool. Throws
+   * std::invalid_argument if no directory is given.
+   */
+  static Poolset GenerateDirectories(const std::vector<std::string> &dirs,
+                                     const std::string &name,
+                                     size_t pool_size);
+};
+
+#endif  // !PMDK_TESTS_SRC_RAS_UTILS_STRIPED_POOLSET_H_
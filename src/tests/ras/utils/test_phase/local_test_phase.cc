@@ -1,5 +1,5 @@
 /*
- * Copyright 2018, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -30,6 +30,11 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 #include "local_test_phase.h"
+#include <libpmemobj.h>
+#include <thread>
+#include "pass_journal/pass_journal.h"
+#include "pool_prestage/pool_prestage.h"
+#include "test_utils/file_utils.h"
 
 LocalTestPhase::LocalTestPhase() {
   if (config_.ReadConfigFile() != 0) {
@@ -50,14 +55,73 @@ LocalTestPhase::LocalTestPhase() {
   std::copy_if(config_.begin(), config_.end(),
                std::back_inserter(safe_namespaces),
                [&i](DimmNamespace) -> bool { return i++ == 1; });
+
+  SetPoolSizes();
+}
+
+unsigned LocalTestPhase::GetWorkers() const {
+  if (config_.GetWorkers() != 0) {
+    return config_.GetWorkers();
+  }
+
+  unsigned workers = std::thread::hardware_concurrency();
+  unsigned namespaces = static_cast<unsigned>(config_.GetSize());
+  if (namespaces > 0 && (workers == 0 || namespaces < workers)) {
+    workers = namespaces;
+  }
+  return workers > 0 ? workers : 1;
+}
+
+void LocalTestPhase::SetPoolSizes() {
+  if (config_.GetPoolSizes().empty()) {
+    pool_sizes_.emplace_back(pool_size_param{"8MiB", PMEMOBJ_MIN_POOL});
+    return;
+  }
+
+  long long capacity = ApiC::GetTotalSpaceT(config_.GetTestDir());
+  for (const auto &dn : config_) {
+    capacity = std::min(capacity, ApiC::GetTotalSpaceT(dn.GetTestDir()));
+  }
+
+  for (const auto &value : config_.GetPoolSizes()) {
+    if (value.back() == '%' && capacity < 0) {
+      throw std::invalid_argument("Cannot read capacity for poolSize " + value);
+    }
+
+    size_t size;
+    try {
+      if (value.back() == '%') {
+        double fraction = std::stod(value) / 100;
+        size = static_cast<size_t>(capacity * fraction) / MEBIBYTE * MEBIBYTE;
+      } else {
+        size = file_utils::GetSize(value);
+      }
+    } catch (const std::logic_error &) {
+      throw std::invalid_argument("Invalid poolSize value: " + value);
+    }
+
+    if (size < PMEMOBJ_MIN_POOL) {
+      throw std::invalid_argument("poolSize " + value +
+                                  " is less than minimal pool size");
+    }
+    pool_sizes_.emplace_back(pool_size_param{value, size});
+  }
 }
 
 int LocalTestPhase::Begin() const {
-  return 0;
+  /* results of previous test runs are not valid for new run */
+  std::string journal = PassJournal::GetPath(config_.GetTestDir());
+  if (ApiC::RegularFileExists(journal) && ApiC::RemoveFile(journal) != 0) {
+    return -1;
+  }
+
+  PoolPrestage &prestage = PoolPrestage::GetInstance();
+  return prestage.Run(prestage.Plan(), config_.GetTestDir());
 }
 
 int LocalTestPhase::Inject() const {
-  InjectManager inject_mgmt{config_.GetTestDir(), policy_};
+  InjectManager inject_mgmt{config_.GetTestDir(), policy_,
+                            config_.GetUscBackend()};
   if (inject_mgmt.RecordUSC(
           std::vector<DimmNamespace>{config_.begin(), config_.end()}) != 0) {
     return -1;
@@ -71,7 +135,8 @@ int LocalTestPhase::Inject() const {
 }
 
 int LocalTestPhase::CheckUSC() const {
-  InjectManager inject_mgmt{config_.GetTestDir(), policy_};
+  InjectManager inject_mgmt{config_.GetTestDir(), policy_,
+                            config_.GetUscBackend()};
   if (inject_mgmt.IsLastShutdownSafe(safe_namespaces) &&
       inject_mgmt.IsLastShutdownUnsafe(unsafe_namespaces)) {
     return 0;
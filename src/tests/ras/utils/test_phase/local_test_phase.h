@@ -1,5 +1,5 @@
 /*
- * Copyright 2018, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -36,6 +36,15 @@
 #include "exit_codes.h"
 #include "test_phase/test_phase.h"
 
+/*
+ * pool_size_param -- size of pools created by parameterized test families,
+ * described by value given in config file.
+ */
+struct pool_size_param {
+  std::string description;
+  size_t size;
+};
+
 class LocalTestPhase : public TestPhase<LocalTestPhase> {
   friend class TestPhase<LocalTestPhase>;
 
@@ -51,6 +60,22 @@ class LocalTestPhase : public TestPhase<LocalTestPhase> {
     return this->config_.GetTestDir();
   }
 
+  /*
+   * GetPoolSizes -- returns pool sizes from 'poolSizes' config node, with
+   * percentages resolved against capacity of the smallest filesystem among
+   * testDir and configured mount points. Defaults to PMEMOBJ_MIN_POOL.
+   */
+  const std::vector<pool_size_param> &GetPoolSizes() const {
+    return this->pool_sizes_;
+  }
+
+  /*
+   * GetWorkers -- returns number of processes tests of the phase are divided
+   * between, from 'workers' config node. For 'auto' returns number of CPUs
+   * limited to number of configured namespaces.
+   */
+  unsigned GetWorkers() const;
+
  protected:
   int Begin() const;
   int Inject() const;
@@ -61,6 +86,8 @@ class LocalTestPhase : public TestPhase<LocalTestPhase> {
   LocalDimmConfiguration config_;
   std::vector<DimmNamespace> safe_namespaces;
   std::vector<DimmNamespace> unsafe_namespaces;
+  std::vector<pool_size_param> pool_sizes_;
   LocalTestPhase();
+  void SetPoolSizes();
 };
 #endif  // LOCAL_TEST_PHASE_H
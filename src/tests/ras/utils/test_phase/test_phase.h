@@ -1,5 +1,5 @@
 /*
- * Copyright 2018, Intel Corporation
+ * Copyright 2018-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -58,6 +58,9 @@ class TestPhase : public NonCopyable {
   const std::string GetPhaseName() const {
     return this->phase_name_;
   }
+  int GetPhaseNumber() const {
+    return this->phase_number_;
+  }
 
  protected:
   InjectPolicy policy_;
@@ -82,6 +85,7 @@ class TestPhase : public NonCopyable {
   ExecutionAction pre_test_action_;
   ExecutionAction post_test_action_;
   std::string phase_name_;
+  int phase_number_ = 0;
 };
 
 template <class T>
@@ -119,12 +123,12 @@ void TestPhase<T>::ParseCmdArgs(int argc, char** argv) {
     throw std::invalid_argument(usage);
   }
 
-  int phase_number = std::atoi(argv[1]);
+  phase_number_ = std::atoi(argv[1]);
   phase_name_ = std::string{"phase_"} + argv[1];
 
-  if (phase_number < 1) {
+  if (phase_number_ < 1) {
     pre_test_action_ = ExecutionAction::none;
-  } else if (phase_number == 1) {
+  } else if (phase_number_ == 1) {
     pre_test_action_ = ExecutionAction::begin;
   } else {
     pre_test_action_ = ExecutionAction::check_usc;
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2023, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -68,6 +68,35 @@ int ApiC::CreateFileT(const std::string &path,
   return CreateFileT(path, std::move(c));
 }
 
+int ApiC::CreateFileDurably(const std::string &path,
+                            const std::string &content) {
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    return -1;
+  }
+  ssize_t written = write(fd, content.data(), content.size());
+  int ret = written == static_cast<ssize_t>(content.size()) && fsync(fd) == 0
+                ? 0
+                : -1;
+  close(fd);
+  if (ret != 0) {
+    return -1;
+  }
+
+  /* directory entry of newly created file has to be persisted as well */
+  size_t slash = path.find_last_of('/');
+  std::string dir = slash == std::string::npos
+                        ? "."
+                        : slash == 0 ? "/" : path.substr(0, slash);
+  int dir_fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+  if (dir_fd == -1) {
+    return -1;
+  }
+  ret = fsync(dir_fd);
+  close(dir_fd);
+  return ret == 0 ? 0 : -1;
+}
+
 int ApiC::ReadFile(const std::string &path, std::string &content) {
   std::ifstream file{path};
 
@@ -202,6 +231,17 @@ long long ApiC::GetFreeSpaceT(const std::string &path) {
   return fs.f_bsize * fs.f_bavail;
 }
 
+long long ApiC::GetTotalSpaceT(const std::string &path) {
+  struct statvfs fs;
+  if (statvfs(path.c_str(), &fs) != 0) {
+    std::cerr << "Unable to get file system statistics: " << strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  return fs.f_frsize * fs.f_blocks;
+}
+
 int ApiC::CreateDirectoryT(const std::string &path) {
   if (mkdir(path.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) == -1) {
     std::cerr << "mkdir failed: " << strerror(errno) << std::endl;
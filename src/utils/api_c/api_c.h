@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2023, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -61,6 +61,14 @@ class ApiC final : NonCopyable {
   static int CreateFileT(const std::string &path,
                          const std::vector<std::string> &content);
 
+  /*
+   * CreateFileDurably -- creates file in given path with given content and
+   * synchronizes it and its parent directory with storage, so it survives
+   * power failure. Returns 0 on success, -1 otherwise.
+   */
+  static int CreateFileDurably(const std::string &path,
+                               const std::string &content);
+
   /*
    * ReadFile -- opens given file and reads its content. Returns 0 on success,
    * prints error message and returns -1 otherwise.
@@ -137,6 +145,12 @@ class ApiC final : NonCopyable {
    */
   static long long GetFreeSpaceT(const std::string &path);
 
+  /*
+   * GetTotalSpaceT -- returns total size in bytes of filesystem containing
+   * given path, prints error message and returns -1 otherwise.
+   */
+  static long long GetTotalSpaceT(const std::string &path);
+
   /* SetEnv -- adds tne environment variable name to the environment
    * with the value value. Returns 0 on success, -1 otherwise. */
   static int SetEnv(const std::string &name, const std::string &value);
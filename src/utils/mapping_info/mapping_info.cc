@@ -0,0 +1,334 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mapping_info.h"
+#include <fcntl.h>
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace {
+/*
+ * ParseArea -- parses smaps area header line, e.g.
+ * "7f0000000000-7f0040000000 rw-s 00000000 103:02 12 /mnt/pmem0/pool".
+ * Returns true if the line is an area header.
+ */
+bool ParseArea(const std::string &line, mapping_info &area) {
+  std::istringstream stream{line};
+  std::string range, perms, offset, dev, inode;
+  if (!(stream >> range >> perms >> offset >> dev >> inode)) {
+    return false;
+  }
+
+  size_t dash = range.find('-');
+  if (dash == std::string::npos ||
+      range.find_first_not_of("0123456789abcdef-") != std::string::npos) {
+    return false;
+  }
+
+  area = mapping_info{};
+  area.start = std::stoull(range.substr(0, dash), nullptr, 16);
+  area.end = std::stoull(range.substr(dash + 1), nullptr, 16);
+  area.offset = std::stoull(offset, nullptr, 16);
+  std::getline(stream >> std::ws, area.path);
+  return true;
+}
+
+void ParseField(const std::string &line, mapping_info &area) {
+  static const std::map<std::string, size_t mapping_info::*> fields{
+      {"KernelPageSize:", &mapping_info::kernel_page_size},
+      {"MMUPageSize:", &mapping_info::mmu_page_size},
+      {"Rss:", &mapping_info::rss},
+      {"AnonHugePages:", &mapping_info::anon_huge_pages},
+      {"ShmemPmdMapped:", &mapping_info::shmem_pmd_mapped},
+      {"FilePmdMapped:", &mapping_info::file_pmd_mapped}};
+
+  std::istringstream stream{line};
+  std::string name;
+  unsigned long long value;
+  if (!(stream >> name >> value)) {
+    return;
+  }
+
+  if (name == "THPeligible:") {
+    area.thp_eligible = value != 0;
+    return;
+  }
+
+  auto field = fields.find(name);
+  if (field != fields.end()) {
+    /* all memory fields in smaps are expressed in kB */
+    area.*(field->second) = value * KIBIBYTE;
+  }
+}
+
+/*
+ * file_extent -- range of file stored contiguously on the device.
+ */
+struct file_extent {
+  uint64_t logical;
+  uint64_t physical;
+  uint64_t length;
+};
+
+/*
+ * ReadExtents -- reads extents of file of given path overlapping range
+ * [offset, offset + len), merging physically contiguous ones. Returns 0 on
+ * success, -1 otherwise.
+ */
+int ReadExtents(const std::string &path, uint64_t offset, uint64_t len,
+                std::vector<file_extent> &extents) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return -1;
+  }
+
+  const unsigned batch = 64;
+  /* fiemap is followed by array of extents */
+  std::vector<uint64_t> buffer(
+      (sizeof(struct fiemap) + batch * sizeof(struct fiemap_extent)) /
+          sizeof(uint64_t) +
+      1);
+  struct fiemap *map = reinterpret_cast<struct fiemap *>(buffer.data());
+
+  extents.clear();
+  uint64_t start = offset;
+  bool last = false;
+  while (!last && start < offset + len) {
+    std::fill(buffer.begin(), buffer.end(), 0);
+    map->fm_start = start;
+    map->fm_length = offset + len - start;
+    map->fm_extent_count = batch;
+    if (ioctl(fd, FS_IOC_FIEMAP, map) != 0) {
+      close(fd);
+      return -1;
+    }
+    if (map->fm_mapped_extents == 0) {
+      break;
+    }
+
+    for (unsigned i = 0; i < map->fm_mapped_extents; ++i) {
+      const struct fiemap_extent &e = map->fm_extents[i];
+      if (!extents.empty() &&
+          extents.back().logical + extents.back().length == e.fe_logical &&
+          extents.back().physical + extents.back().length == e.fe_physical) {
+        extents.back().length += e.fe_length;
+      } else {
+        extents.push_back({e.fe_logical, e.fe_physical, e.fe_length});
+      }
+      last = (e.fe_flags & FIEMAP_EXTENT_LAST) != 0;
+      start = e.fe_logical + e.fe_length;
+    }
+  }
+
+  close(fd);
+  return 0;
+}
+}  // namespace
+
+int MappingInfo::ReadMappings(const void *addr, size_t len,
+                              std::vector<mapping_info> &mappings) {
+  std::ifstream smaps{"/proc/self/smaps"};
+  if (!smaps.good()) {
+    std::cerr << "Cannot open /proc/self/smaps: " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(addr);
+  const uintptr_t end = begin + len;
+
+  mappings.clear();
+  mapping_info area;
+  bool in_range = false;
+  std::string line;
+  while (std::getline(smaps, line)) {
+    mapping_info next;
+    if (ParseArea(line, next)) {
+      if (in_range) {
+        mappings.emplace_back(area);
+      }
+      area = next;
+      in_range = area.start < end && area.end > begin;
+    } else if (in_range) {
+      ParseField(line, area);
+    }
+  }
+  if (in_range) {
+    mappings.emplace_back(area);
+  }
+
+  if (mappings.empty()) {
+    std::cerr << "No mapping found for address " << addr << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+size_t MappingInfo::GetHugeMapped(const mapping_info &mapping) {
+  /* hugetlbfs areas are mapped with huge pages only */
+  if (mapping.kernel_page_size >= HUGE_PAGE_SIZE) {
+    return mapping.rss;
+  }
+  return std::min(mapping.GetPmdMapped(), mapping.rss);
+}
+
+double MappingInfo::GetHugeShare(const std::vector<mapping_info> &mappings) {
+  size_t huge = 0, rss = 0;
+  for (const auto &m : mappings) {
+    huge += GetHugeMapped(m);
+    rss += m.rss;
+  }
+  return rss > 0 ? static_cast<double>(huge) / rss : 0;
+}
+
+PageSizeVerdict MappingInfo::GetVerdict(const mapping_info &mapping) {
+  return GetVerdict(std::vector<mapping_info>{mapping});
+}
+
+PageSizeVerdict MappingInfo::GetVerdict(
+    const std::vector<mapping_info> &mappings) {
+  size_t rss = 0;
+  for (const auto &m : mappings) {
+    rss += m.rss;
+  }
+  if (rss == 0) {
+    return PageSizeVerdict::unknown;
+  }
+
+  double share = GetHugeShare(mappings);
+  if (share == 0) {
+    return PageSizeVerdict::fallback;
+  }
+  return share < 1 ? PageSizeVerdict::partial : PageSizeVerdict::huge;
+}
+
+double MappingInfo::GetAlignedShare(const std::vector<mapping_info> &mappings) {
+  size_t aligned = 0, total = 0;
+  for (const auto &m : mappings) {
+    std::vector<file_extent> extents;
+    if (m.path.empty() || m.path.front() != '/' ||
+        ReadExtents(m.path, m.offset, m.GetSize(), extents) != 0) {
+      return -1;
+    }
+    total += m.GetSize();
+
+    /* first 2 MiB aligned virtual address of the area */
+    uintptr_t va = (m.start + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE *
+                   HUGE_PAGE_SIZE;
+    for (; va + HUGE_PAGE_SIZE <= m.end; va += HUGE_PAGE_SIZE) {
+      uint64_t file_offset = m.offset + (va - m.start);
+      if (file_offset % HUGE_PAGE_SIZE != 0) {
+        /* no window of the area is aligned in the file */
+        break;
+      }
+      for (const auto &e : extents) {
+        if (e.logical <= file_offset &&
+            file_offset + HUGE_PAGE_SIZE <= e.logical + e.length) {
+          if ((e.physical + file_offset - e.logical) % HUGE_PAGE_SIZE == 0) {
+            aligned += HUGE_PAGE_SIZE;
+          }
+          break;
+        }
+      }
+    }
+  }
+  return total > 0 ? static_cast<double>(aligned) / total : -1;
+}
+
+PageSizeVerdict MappingInfo::GetAlignmentVerdict(
+    const std::vector<mapping_info> &mappings) {
+  double share = GetAlignedShare(mappings);
+  if (share < 0) {
+    return PageSizeVerdict::unknown;
+  }
+  if (share == 0) {
+    return PageSizeVerdict::fallback;
+  }
+  return share < 1 ? PageSizeVerdict::partial : PageSizeVerdict::huge;
+}
+
+std::string MappingInfo::ToString(PageSizeVerdict verdict) {
+  switch (verdict) {
+    case PageSizeVerdict::huge:
+      return "huge";
+    case PageSizeVerdict::partial:
+      return "partial";
+    case PageSizeVerdict::fallback:
+      return "fallback";
+    case PageSizeVerdict::unknown:
+      return "unknown";
+  }
+  return "unknown";
+}
+
+int MappingInfo::ReadProcessMemory(process_memory &memory) {
+  std::ifstream status{"/proc/self/status"};
+  if (!status.good()) {
+    std::cerr << "Cannot open /proc/self/status: " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  memory = process_memory{};
+  bool vm_size_found = false, rss_found = false;
+  std::string line;
+  while (std::getline(status, line)) {
+    std::istringstream stream{line};
+    std::string name;
+    unsigned long long value;
+    if (!(stream >> name >> value)) {
+      continue;
+    }
+    if (name == "VmSize:") {
+      memory.vm_size = value * KIBIBYTE;
+      vm_size_found = true;
+    } else if (name == "VmRSS:") {
+      memory.rss = value * KIBIBYTE;
+      rss_found = true;
+    }
+  }
+
+  if (!vm_size_found || !rss_found) {
+    std::cerr << "VmSize or VmRSS not found in /proc/self/status" << std::endl;
+    return -1;
+  }
+  return 0;
+}
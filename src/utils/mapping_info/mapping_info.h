@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_MAPPING_INFO_MAPPING_INFO_H_
+#define PMDK_TESTS_SRC_UTILS_MAPPING_INFO_MAPPING_INFO_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "constants.h"
+#include "non_copyable/non_copyable.h"
+
+/*
+ * mapping_info -- page size related fields of single virtual memory area
+ * listed in /proc/self/smaps. All sizes are specified in bytes.
+ */
+struct mapping_info {
+  uintptr_t start = 0;
+  uintptr_t end = 0;
+  uint64_t offset = 0;
+  std::string path;
+  size_t kernel_page_size = 0;
+  size_t mmu_page_size = 0;
+  size_t rss = 0;
+  size_t anon_huge_pages = 0;
+  size_t shmem_pmd_mapped = 0;
+  size_t file_pmd_mapped = 0;
+  bool thp_eligible = false;
+
+  size_t GetSize() const {
+    return end - start;
+  }
+  size_t GetPmdMapped() const {
+    return anon_huge_pages + shmem_pmd_mapped + file_pmd_mapped;
+  }
+};
+
+/*
+ * process_memory -- virtual address space size and resident set size of the
+ * calling process read from /proc/self/status. Sizes are specified in bytes.
+ */
+struct process_memory {
+  size_t vm_size = 0;
+  size_t rss = 0;
+};
+
+/*
+ * PageSizeVerdict -- result of page size probe, based on share of resident
+ * memory of the area mapped with huge page table entries (AnonHugePages,
+ * ShmemPmdMapped, FilePmdMapped or hugetlbfs pages). Pages have to be touched
+ * before the probe, as only resident memory is accounted:
+ * huge - all resident memory is mapped with 2 MiB or bigger pages,
+ * partial - part of resident memory is mapped with huge pages,
+ * fallback - no resident memory is mapped with huge pages,
+ * unknown - no memory is accounted, e.g. for DAX mappings, which are not
+ * counted in Rss.
+ */
+enum class PageSizeVerdict { huge, partial, fallback, unknown };
+
+class MappingInfo final : NonCopyable {
+ public:
+  /*
+   * ReadMappings -- fills 'mappings' with all areas from /proc/self/smaps
+   * overlapping the [addr, addr + len) range. Returns 0 on success, prints
+   * error message and returns -1 otherwise.
+   */
+  static int ReadMappings(const void *addr, size_t len,
+                          std::vector<mapping_info> &mappings);
+
+  /*
+   * GetHugeMapped -- returns size of resident memory of the area mapped with
+   * huge pages.
+   */
+  static size_t GetHugeMapped(const mapping_info &mapping);
+
+  /*
+   * GetHugeShare -- returns share of resident memory of given areas mapped
+   * with huge pages, from 0 to 1. Returns 0 if no memory is resident.
+   */
+  static double GetHugeShare(const std::vector<mapping_info> &mappings);
+
+  static PageSizeVerdict GetVerdict(const mapping_info &mapping);
+
+  /*
+   * GetVerdict -- returns page size verdict for all resident memory of given
+   * areas.
+   */
+  static PageSizeVerdict GetVerdict(const std::vector<mapping_info> &mappings);
+
+  /*
+   * GetAlignedShare -- returns share of given file-backed areas, from 0 to 1,
+   * which can be mapped with 2 MiB page table entries: 2 MiB windows aligned
+   * both in virtual address space and in the file, backed by single 2 MiB
+   * aligned extent of the file system. Meant for DAX mappings, which are not
+   * accounted in Rss. Returns -1 if extents of the files cannot be read.
+   */
+  static double GetAlignedShare(const std::vector<mapping_info> &mappings);
+
+  /*
+   * GetAlignmentVerdict -- returns page size verdict based on share of given
+   * areas returned by GetAlignedShare().
+   */
+  static PageSizeVerdict GetAlignmentVerdict(
+      const std::vector<mapping_info> &mappings);
+
+  static std::string ToString(PageSizeVerdict verdict);
+
+  /*
+   * ReadProcessMemory -- reads VmSize and VmRSS of the calling process.
+   * Returns 0 on success, prints error message and returns -1 otherwise.
+   */
+  static int ReadProcessMemory(process_memory &memory);
+
+ private:
+  static const size_t HUGE_PAGE_SIZE = 2 * MEBIBYTE;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_MAPPING_INFO_MAPPING_INFO_H_
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_PERF_COUNTER_PERF_COUNTER_H_
+#define PMDK_TESTS_SRC_UTILS_PERF_COUNTER_PERF_COUNTER_H_
+
+#include <cstdint>
+#include "non_copyable/non_copyable.h"
+
+enum class PerfEvent { dtlb_load_misses, dtlb_store_misses };
+
+/*
+ * PerfCounter -- class that counts single hardware event for calling thread
+ * with perf_event_open(2). Counter is unavailable when kernel or hypervisor
+ * does not expose given event or perf_event_paranoid forbids access to it.
+ */
+class PerfCounter final : NonCopyable {
+ private:
+  int fd_ = -1;
+
+ public:
+  PerfCounter(PerfEvent event);
+  ~PerfCounter();
+
+  bool IsAvailable() const {
+    return fd_ != -1;
+  }
+
+  /*
+   * Start -- resets and enables the counter. Returns 0 on success, -1
+   * otherwise.
+   */
+  int Start();
+
+  /*
+   * Stop -- disables the counter. Returns 0 on success, -1 otherwise.
+   */
+  int Stop();
+
+  /*
+   * Read -- returns number of events counted between Start() and Stop()
+   * calls, or -1 if counter is unavailable.
+   */
+  long long Read() const;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_PERF_COUNTER_PERF_COUNTER_H_
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "huge_obj_data.h"
+#include <cerrno>
+#include <iostream>
+
+int HugeObjData::Alloc(size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    PMEMoid oid;
+    if (pmemobj_alloc(pop_, &oid, obj_size_, type_num_, nullptr, nullptr) !=
+        0) {
+      std::cerr << "Allocation of " << obj_size_
+                << " bytes failed. Errno: " << errno << std::endl
+                << pmemobj_errormsg() << std::endl;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+size_t HugeObjData::Fill() {
+  size_t words = obj_size_ / sizeof(uint64_t);
+  size_t written = 0;
+  uint64_t index = 0;
+
+  for (PMEMoid oid = POBJ_FIRST_TYPE_NUM(pop_, type_num_); !OID_IS_NULL(oid);
+       oid = POBJ_NEXT_TYPE_NUM(oid)) {
+    uint64_t *data = static_cast<uint64_t *>(pmemobj_direct(oid));
+    WritePattern(data, words, index);
+    pmemobj_persist(pop_, data, words * sizeof(uint64_t));
+    written += words * sizeof(uint64_t);
+    ++index;
+  }
+
+  return written;
+}
+
+size_t HugeObjData::Free() {
+  size_t freed = 0;
+  PMEMoid oid = POBJ_FIRST_TYPE_NUM(pop_, type_num_);
+
+  while (!OID_IS_NULL(oid)) {
+    PMEMoid next = POBJ_NEXT_TYPE_NUM(oid);
+    pmemobj_free(&oid);
+    oid = next;
+    ++freed;
+  }
+  return freed;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HUGE_OBJ_DATA_H
+#define HUGE_OBJ_DATA_H
+
+#include <cstddef>
+#include <cstdint>
+#include "indexed_obj_data.h"
+
+/*
+ * HugeObjData -- class that allocates objects bigger than pmemobj run size,
+ * served by huge chunk allocator, and fills them with pattern derived from
+ * object index.
+ */
+class HugeObjData : public IndexedObjData {
+ public:
+  HugeObjData(PMEMobjpool *pop, size_t obj_size)
+      : IndexedObjData(pop, obj_size, 1024) {
+  }
+
+  /*
+   * Alloc -- allocates given number of objects without initializing their
+   * content. Returns 0 on success, -1 otherwise.
+   */
+  int Alloc(size_t count);
+
+  /*
+   * Fill -- numbers all allocated objects, writes and persists pattern in
+   * them. Returns number of bytes written.
+   */
+  size_t Fill();
+
+  /*
+   * Free -- frees all objects allocated by HugeObjData. Returns number of
+   * objects freed.
+   */
+  size_t Free();
+};
+
+#endif  // HUGE_OBJ_DATA_H
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "indexed_obj_data.h"
+#include <iostream>
+#include <vector>
+
+uint64_t IndexedObjData::GetPattern(uint64_t index, size_t word) {
+  return (index * 0x9E3779B97F4A7C15ULL) ^ word;
+}
+
+void IndexedObjData::WritePattern(uint64_t *data, size_t words,
+                                  uint64_t index) {
+  data[0] = index;
+  for (size_t w = 1; w < words; ++w) {
+    data[w] = GetPattern(index, w);
+  }
+}
+
+int IndexedObjData::Verify(size_t count) const {
+  size_t words = obj_size_ / sizeof(uint64_t);
+  std::vector<bool> found(count, false);
+
+  for (PMEMoid oid = POBJ_FIRST_TYPE_NUM(pop_, type_num_); !OID_IS_NULL(oid);
+       oid = POBJ_NEXT_TYPE_NUM(oid)) {
+    if (pmemobj_alloc_usable_size(oid) < obj_size_) {
+      std::cerr << "Object size " << pmemobj_alloc_usable_size(oid)
+                << " is less than expected " << obj_size_ << std::endl;
+      return -1;
+    }
+
+    const uint64_t *data = static_cast<const uint64_t *>(pmemobj_direct(oid));
+    uint64_t index = data[0];
+    if (index >= count || found[index]) {
+      std::cerr << "Unexpected object with index " << index << std::endl;
+      return -1;
+    }
+    for (size_t w = 1; w < words; ++w) {
+      if (data[w] != GetPattern(index, w)) {
+        std::cerr << "Pattern mismatch in object " << index << " at offset "
+                  << w * sizeof(uint64_t) << std::endl;
+        return -1;
+      }
+    }
+    found[index] = true;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!found[i]) {
+      std::cerr << "Object with index " << i << " not found" << std::endl;
+      return -1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef INDEXED_OBJ_DATA_H
+#define INDEXED_OBJ_DATA_H
+
+#include <libpmemobj.h>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * IndexedObjData -- base class of pool data made of objects of one type
+ * number and size, filled with pattern derived from object index. Index is
+ * stored in first word of each object, hence objects can be verified
+ * regardless of order in which pmemobj iterates over them. Object size has to
+ * be a multiple of 8 bytes.
+ */
+class IndexedObjData {
+ public:
+  /*
+   * Verify -- checks that pool contains exactly given number of objects,
+   * each with expected size and pattern. Returns 0 on success, -1 otherwise.
+   */
+  int Verify(size_t count) const;
+
+ protected:
+  IndexedObjData(PMEMobjpool *pop, size_t obj_size, uint64_t type_num)
+      : pop_(pop), obj_size_(obj_size), type_num_(type_num) {
+  }
+
+  /*
+   * WritePattern -- numbers object with given index and writes its pattern
+   * in given number of words, without persisting them.
+   */
+  static void WritePattern(uint64_t *data, size_t words, uint64_t index);
+
+  PMEMobjpool *pop_;
+  size_t obj_size_;
+  const uint64_t type_num_;
+
+ private:
+  static uint64_t GetPattern(uint64_t index, size_t word);
+};
+
+#endif  // INDEXED_OBJ_DATA_H
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "small_obj_data.h"
+#include <cerrno>
+#include <iostream>
+
+int SmallObjData::Construct(PMEMobjpool *pop, void *ptr, void *arg) {
+  const obj_args *args = static_cast<const obj_args *>(arg);
+  uint64_t *data = static_cast<uint64_t *>(ptr);
+  WritePattern(data, args->words, args->index);
+  pmemobj_persist(pop, data, args->words * sizeof(uint64_t));
+  return 0;
+}
+
+int SmallObjData::Write(size_t count) {
+  obj_args args{obj_size_ / sizeof(uint64_t), 0};
+  for (; args.index < count; ++args.index) {
+    PMEMoid oid;
+    if (pmemobj_alloc(pop_, &oid, obj_size_, type_num_, Construct, &args) !=
+        0) {
+      std::cerr << "Allocation of object " << args.index
+                << " failed. Errno: " << errno << std::endl
+                << pmemobj_errormsg() << std::endl;
+      return -1;
+    }
+  }
+  return 0;
+}
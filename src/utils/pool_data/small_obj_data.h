@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef SMALL_OBJ_DATA_H
+#define SMALL_OBJ_DATA_H
+
+#include <cstddef>
+#include <cstdint>
+#include "indexed_obj_data.h"
+
+/*
+ * SmallObjData -- class that allocates objects smaller than pmemobj run size,
+ * served from runs, and writes pattern derived from object index in them in
+ * allocation constructor.
+ */
+class SmallObjData : public IndexedObjData {
+ public:
+  SmallObjData(PMEMobjpool *pop, size_t obj_size)
+      : IndexedObjData(pop, obj_size, 1025) {
+  }
+
+  /*
+   * Write -- allocates given number of objects, numbering them from 0 and
+   * writing their pattern. Returns 0 on success, -1 otherwise.
+   */
+  int Write(size_t count);
+
+ private:
+  static int Construct(PMEMobjpool *pop, void *ptr, void *arg);
+
+  struct obj_args {
+    size_t words;
+    uint64_t index;
+  };
+};
+
+#endif  // SMALL_OBJ_DATA_H
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "part.h"
+#include <limits>
+#include <stdexcept>
+#include "constants.h"
+
+Part::Part(const std::string &size, const std::string &path)
+    : size_(0), unit_(SizeUnit::byte), path_(path) {
+  if (ParseSize(size, size_, unit_) != 0) {
+    throw std::invalid_argument("Invalid part size: " + size);
+  }
+}
+
+size_t Part::GetMultiplier(SizeUnit unit) {
+  switch (unit) {
+    case SizeUnit::k:
+    case SizeUnit::kib:
+      return KIBIBYTE;
+    case SizeUnit::m:
+    case SizeUnit::mib:
+      return MEBIBYTE;
+    case SizeUnit::g:
+    case SizeUnit::gib:
+      return GIGIBYTE;
+    case SizeUnit::t:
+    case SizeUnit::tib:
+      return TEBIBYTE;
+    case SizeUnit::p:
+    case SizeUnit::pib:
+      return PEBIBYTE;
+    case SizeUnit::kb:
+      return KILOBYTE;
+    case SizeUnit::mb:
+      return MEGABYTE;
+    case SizeUnit::gb:
+      return GIGABYTE;
+    case SizeUnit::tb:
+      return TERABYTE;
+    case SizeUnit::pb:
+      return PETABYTE;
+    default:
+      return 1;
+  }
+}
+
+const char *Part::ToString(SizeUnit unit) {
+  switch (unit) {
+    case SizeUnit::b:
+      return "B";
+    case SizeUnit::k:
+      return "K";
+    case SizeUnit::m:
+      return "M";
+    case SizeUnit::g:
+      return "G";
+    case SizeUnit::t:
+      return "T";
+    case SizeUnit::p:
+      return "P";
+    case SizeUnit::kib:
+      return "KiB";
+    case SizeUnit::mib:
+      return "MiB";
+    case SizeUnit::gib:
+      return "GiB";
+    case SizeUnit::tib:
+      return "TiB";
+    case SizeUnit::pib:
+      return "PiB";
+    case SizeUnit::kb:
+      return "KB";
+    case SizeUnit::mb:
+      return "MB";
+    case SizeUnit::gb:
+      return "GB";
+    case SizeUnit::tb:
+      return "TB";
+    case SizeUnit::pb:
+      return "PB";
+    default:
+      return "";
+  }
+}
+
+int Part::ParseSize(const char *str, size_t len, size_t &value,
+                    SizeUnit &unit) {
+  size_t i = 0;
+  size_t val = 0;
+  for (; i < len && str[i] >= '0' && str[i] <= '9'; ++i) {
+    size_t digit = static_cast<size_t>(str[i] - '0');
+    if (val > (std::numeric_limits<size_t>::max() - digit) / 10) {
+      return -1;
+    }
+    val = val * 10 + digit;
+  }
+  if (i == 0) {
+    return -1;
+  }
+
+  /* suffix is at most three characters: B, [KMGTP], [KMGTP]B or [KMGTP]iB */
+  const char *suffix = str + i;
+  size_t suffix_len = len - i;
+  if (suffix_len == 0) {
+    unit = SizeUnit::byte;
+  } else if (suffix_len == 1 && suffix[0] == 'B') {
+    unit = SizeUnit::b;
+  } else {
+    static const SizeUnit units[3][5] = {
+        {SizeUnit::k, SizeUnit::m, SizeUnit::g, SizeUnit::t, SizeUnit::p},
+        {SizeUnit::kb, SizeUnit::mb, SizeUnit::gb, SizeUnit::tb, SizeUnit::pb},
+        {SizeUnit::kib, SizeUnit::mib, SizeUnit::gib, SizeUnit::tib,
+         SizeUnit::pib}};
+    int scale;
+    switch (suffix[0]) {
+      case 'K':
+        scale = 0;
+        break;
+      case 'M':
+        scale = 1;
+        break;
+      case 'G':
+        scale = 2;
+        break;
+      case 'T':
+        scale = 3;
+        break;
+      case 'P':
+        scale = 4;
+        break;
+      default:
+        return -1;
+    }
+    if (suffix_len == 1) {
+      unit = units[0][scale];
+    } else if (suffix_len == 2 && suffix[1] == 'B') {
+      unit = units[1][scale];
+    } else if (suffix_len == 3 && suffix[1] == 'i' && suffix[2] == 'B') {
+      unit = units[2][scale];
+    } else {
+      return -1;
+    }
+  }
+
+  if (val > std::numeric_limits<size_t>::max() / GetMultiplier(unit)) {
+    return -1;
+  }
+
+  value = val;
+  return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2018, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -33,26 +33,77 @@
 #ifndef PMDK_TESTS_SRC_UTILS_POOLSET_PART_H_
 #define PMDK_TESTS_SRC_UTILS_POOLSET_PART_H_
 
+#include <cstddef>
 #include <string>
 
+/*
+ * SizeUnit -- unit of part size as written in pool set file. Units with and
+ * without 'i' are kept apart, so that the text form of the part is preserved.
+ */
+enum class SizeUnit {
+  byte, b, k, m, g, t, p, kib, mib, gib, tib, pib, kb, mb, gb, tb, pb
+};
+
 /*
  * Part -- class that represents part of replica specified in pool set file.
+ * Path ending with '/' denotes directory part, for which size is the maximal
+ * size of part files created by the library in the directory.
  */
 class Part final {
  private:
-  std::string size_;
+  size_t size_;
+  SizeUnit unit_;
   std::string path_;
 
  public:
-  Part(const std::string &size, const std::string &path)
-      : size_(size), path_(path) {
+  Part(size_t size, SizeUnit unit, const std::string &path)
+      : size_(size), unit_(unit), path_(path) {
+  }
+  /*
+   * Part -- creates part from size given in pool set file format, e.g. "9MB".
+   * Throws std::invalid_argument if size cannot be parsed.
+   */
+  Part(const std::string &size, const std::string &path);
+
+  /*
+   * GetSize -- returns size of the part in bytes.
+   */
+  size_t GetSize() const {
+    return size_ * GetMultiplier(unit_);
+  }
+  size_t GetSizeValue() const {
+    return size_;
+  }
+  SizeUnit GetUnit() const {
+    return unit_;
+  }
+  /*
+   * GetSizeString -- returns size of the part in pool set file format.
+   */
+  std::string GetSizeString() const {
+    return std::to_string(size_) + ToString(unit_);
   }
-  const std::string &GetSize() const {
-    return this->size_;
-  };
   const std::string &GetPath() const {
     return this->path_;
   };
+  bool IsDirectory() const {
+    return !path_.empty() && path_.back() == '/';
+  }
+
+  static size_t GetMultiplier(SizeUnit unit);
+  static const char *ToString(SizeUnit unit);
+
+  /*
+   * ParseSize -- parses size in pool set file format given as 'len' characters
+   * of 'str' (not necessarily null-terminated) into value and unit. Returns 0
+   * on success, -1 otherwise, also if size in bytes does not fit in size_t.
+   */
+  static int ParseSize(const char *str, size_t len, size_t &value,
+                       SizeUnit &unit);
+  static int ParseSize(const std::string &size, size_t &value,
+                       SizeUnit &unit) {
+    return ParseSize(size.data(), size.size(), value, unit);
+  }
 };
 
 #endif  // !PMDK_TESTS_SRC_UTILS_POOLSET_PART_H_
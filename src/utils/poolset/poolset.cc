@@ -1,5 +1,5 @@
 /*
- * Copyright 2017, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -34,6 +34,11 @@
 
 std::vector<Part> Poolset::GetParts() const {
   std::vector<Part> parts;
+  size_t count = 0;
+  for (const auto &replica : this->replicas_) {
+    count += replica.GetParts().size();
+  }
+  parts.reserve(count);
   for (const auto &replica : this->replicas_) {
     for (const auto &part : replica.GetParts()) {
       parts.emplace_back(part);
@@ -51,10 +56,21 @@ void Poolset::InitializeReplicas(std::initializer_list<replica> &&content) {
 
 std::vector<std::string> Poolset::GetContent() const {
   std::vector<std::string> content;
+  size_t lines = replicas_.size() + options_.size();
+  for (const auto &replica : replicas_) {
+    lines += replica.GetParts().size();
+  }
+  content.reserve(lines);
+
   for (const auto &replica : replicas_) {
     content.emplace_back(replica.GetHeader());
+    if (content.size() == 1) {
+      for (const auto option : options_) {
+        content.emplace_back(std::string{"OPTION "} + ToString(option));
+      }
+    }
     for (const auto &part : replica.GetParts()) {
-      content.emplace_back(part.GetSize() + " " + part.GetPath());
+      content.emplace_back(part.GetSizeString() + " " + part.GetPath());
     }
   }
   return content;
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2023, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -39,6 +39,12 @@
 
 using replica = std::initializer_list<std::string>;
 
+/*
+ * PoolsetOption -- option of pool set file given in "OPTION" line following
+ * the "PMEMPOOLSET" header.
+ */
+enum class PoolsetOption { singlehdr, nohdrs };
+
 /*
  * Poolset -- class that represents pool set file.
  */
@@ -49,6 +55,7 @@ class Poolset final {
   std::string name_ = "pool.set";
   std::string path_ = "/" + name_;
   std::vector<Replica> replicas_;
+  std::vector<PoolsetOption> options_;
   void InitializeReplicas(std::initializer_list<replica> &&content);
 
  public:
@@ -64,6 +71,16 @@ class Poolset final {
     path_ = dir_ + "/" + name_;
     InitializeReplicas(std::move(content));
   }
+  Poolset(const std::string &dir, const std::string &name,
+          std::vector<Replica> replicas,
+          std::vector<PoolsetOption> options = {})
+      : replica_counter_(static_cast<int>(replicas.size())),
+        dir_(dir),
+        name_(name),
+        replicas_(std::move(replicas)),
+        options_(std::move(options)) {
+    path_ = dir_ + "/" + name_;
+  }
 
   const std::string &GetName() const {
     return this->name_;
@@ -81,10 +98,22 @@ class Poolset final {
   const std::vector<Replica> &GetReplicas() const {
     return this->replicas_;
   };
+  const std::vector<PoolsetOption> &GetOptions() const {
+    return this->options_;
+  }
+  static const char *ToString(PoolsetOption option) {
+    return option == PoolsetOption::singlehdr ? "SINGLEHDR" : "NOHDRS";
+  }
   /*
-   * GetParts -- returns the vector of all parts specified in the pool set file.
+   * GetParts -- returns the vector of copies of all parts specified in the pool
+   * set file. Iterate GetReplicas() to access parts without copying them.
    */
   std::vector<Part> GetParts() const;
+  /*
+   * GetContent -- returns lines of the pool set file, options follow the
+   * header of master replica. This is the only place where text form of part
+   * sizes is produced.
+   */
   std::vector<std::string> GetContent() const;
 };
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "poolset_builder.h"
+#include <stdexcept>
+
+std::vector<Part> &PoolsetBuilder::CurrentReplica() {
+  if (parts_.empty()) {
+    throw std::logic_error("Part added to " + name_ + " before any replica");
+  }
+  return parts_.back();
+}
+
+PoolsetBuilder &PoolsetBuilder::AddReplica() {
+  headers_.emplace_back(headers_.empty() ? "PMEMPOOLSET" : "REPLICA");
+  parts_.emplace_back();
+  return *this;
+}
+
+PoolsetBuilder &PoolsetBuilder::AddPart(const Part &part) {
+  CurrentReplica().emplace_back(part);
+  return *this;
+}
+
+PoolsetBuilder &PoolsetBuilder::AddDirectoryPart(size_t size, SizeUnit unit,
+                                                 const std::string &dir) {
+  if (dir.empty() || dir.back() != '/') {
+    return AddPart(Part{size, unit, dir + "/"});
+  }
+  return AddPart(Part{size, unit, dir});
+}
+
+PoolsetBuilder &PoolsetBuilder::AddParts(size_t count, size_t size,
+                                         SizeUnit unit,
+                                         const std::vector<std::string> &dirs,
+                                         const std::string &name) {
+  if (dirs.empty()) {
+    throw std::invalid_argument("No directories given for parts of " + name);
+  }
+
+  std::vector<Part> &parts = CurrentReplica();
+  parts.reserve(parts.size() + count);
+  for (size_t i = 0; i < count; ++i) {
+    parts.emplace_back(size, unit, dirs[i % dirs.size()] + name + ".part" +
+                                       std::to_string(i));
+  }
+  return *this;
+}
+
+Poolset PoolsetBuilder::Build() const {
+  std::vector<Replica> replicas;
+  replicas.reserve(parts_.size());
+  for (size_t i = 0; i < parts_.size(); ++i) {
+    replicas.emplace_back(headers_[i], parts_[i], static_cast<int>(i));
+  }
+  return Poolset{dir_, name_, std::move(replicas), options_};
+}
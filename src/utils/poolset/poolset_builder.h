@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_BUILDER_H_
+#define PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_BUILDER_H_
+
+#include <string>
+#include <vector>
+#include "poolset.h"
+
+/*
+ * PoolsetBuilder -- builds Poolset from typed parts. First added replica is the
+ * master replica, following ones are secondary replicas. Adding parts before
+ * any replica throws std::logic_error.
+ *
+ * Example:
+ *   Poolset p = PoolsetBuilder{dir, "pool.set"}
+ *                   .AddReplica()
+ *                   .AddParts(1000, 2, SizeUnit::mib, dirs, "master")
+ *                   .AddReplica()
+ *                   .AddPart(2, SizeUnit::gib, dir + "replica.part0")
+ *                   .Build();
+ */
+class PoolsetBuilder final {
+ private:
+  std::string dir_;
+  std::string name_;
+  std::vector<std::string> headers_;
+  std::vector<std::vector<Part>> parts_;
+  std::vector<PoolsetOption> options_;
+
+  std::vector<Part> &CurrentReplica();
+
+ public:
+  PoolsetBuilder(const std::string &dir, const std::string &name)
+      : dir_(dir), name_(name) {
+  }
+
+  PoolsetBuilder &AddReplica();
+  PoolsetBuilder &AddPart(const Part &part);
+  PoolsetBuilder &AddPart(size_t size, SizeUnit unit, const std::string &path) {
+    return AddPart(Part{size, unit, path});
+  }
+
+  /*
+   * AddDirectoryPart -- adds part of at most given size to the current
+   * replica, which files are created by the library in given directory.
+   */
+  PoolsetBuilder &AddDirectoryPart(size_t size, SizeUnit unit,
+                                   const std::string &dir);
+
+  PoolsetBuilder &AddOption(PoolsetOption option) {
+    options_.emplace_back(option);
+    return *this;
+  }
+
+  /*
+   * AddParts -- adds 'count' parts of given size to the current replica. Parts
+   * are spread round-robin across 'dirs' and named
+   * "<dir><name>.part<index>".
+   */
+  PoolsetBuilder &AddParts(size_t count, size_t size, SizeUnit unit,
+                           const std::vector<std::string> &dirs,
+                           const std::string &name);
+
+  Poolset Build() const;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_BUILDER_H_
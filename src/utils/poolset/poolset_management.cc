@@ -1,5 +1,5 @@
 /*
- * Copyright 2017, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -31,20 +31,63 @@
  */
 
 #include "poolset_management.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <map>
+#include "timer/timer.h"
+
+namespace {
+/*
+ * PreallocateDevice -- allocates given parts one after another. Returns 0 on
+ * success, prints error message and returns -1 otherwise.
+ */
+int PreallocateDevice(const std::vector<const Part *> &parts,
+                      std::vector<part_preallocation> &stats) {
+  for (const auto part : parts) {
+    Timer timer;
+    timer.Start();
+    int fd = open(part->GetPath().c_str(), O_WRONLY | O_CREAT, 0644);
+    if (fd == -1) {
+      std::cerr << "Creating " << part->GetPath()
+                << " failed: " << std::strerror(errno) << std::endl;
+      return -1;
+    }
+    int ret = posix_fallocate(fd, 0, static_cast<off_t>(part->GetSize()));
+    close(fd);
+    timer.Stop();
+    if (ret != 0) {
+      std::cerr << "Allocating " << part->GetPath()
+                << " failed: " << std::strerror(ret) << std::endl;
+      return -1;
+    }
+    stats.emplace_back(part_preallocation{part->GetPath(), part->GetSize(),
+                                          timer.GetElapsed()});
+  }
+  return 0;
+}
+}  // namespace
 
 bool PoolsetManagement::AllFilesExist(const Poolset &p) {
-  for (const auto &part : p.GetParts()) {
-    if (!PartExists(part)) {
-      return false;
+  for (const auto &replica : p.GetReplicas()) {
+    for (const auto &part : replica.GetParts()) {
+      if (!PartExists(part)) {
+        return false;
+      }
     }
   }
   return true;
 }
 
 bool PoolsetManagement::NoFilesExist(const Poolset &p) {
-  for (const auto &part : p.GetParts()) {
-    if (PartExists(part)) {
-      return false;
+  for (const auto &replica : p.GetReplicas()) {
+    for (const auto &part : replica.GetParts()) {
+      if (PartExists(part)) {
+        return false;
+      }
     }
   }
   return true;
@@ -52,7 +95,7 @@ bool PoolsetManagement::NoFilesExist(const Poolset &p) {
 
 bool PoolsetManagement::ReplicaExists(const Replica &r) {
   for (const auto &part : r.GetParts()) {
-    if (!api_c_.RegularFileExists(part.GetPath())) {
+    if (!PartExists(part)) {
       return false;
     }
   }
@@ -60,6 +103,9 @@ bool PoolsetManagement::ReplicaExists(const Replica &r) {
 }
 
 bool PoolsetManagement::PartExists(const Part &p) {
+  if (p.IsDirectory()) {
+    return api_c_.DirectoryExists(p.GetPath());
+  }
   return api_c_.RegularFileExists(p.GetPath());
 }
 
@@ -77,12 +123,61 @@ int PoolsetManagement::RemovePoolsetFile(const Poolset &p) {
 
 int PoolsetManagement::RemovePartsFromPoolset(const Poolset &p) {
   int ret = 0;
-  for (const auto &part : p.GetParts()) {
-    ret |= api_c_.RemoveFile(part.GetPath());
+  for (const auto &replica : p.GetReplicas()) {
+    for (const auto &part : replica.GetParts()) {
+      ret |= RemovePart(part);
+    }
   }
   return ret;
 }
 
 int PoolsetManagement::RemovePart(const Part &p) {
+  if (p.IsDirectory()) {
+    return api_c_.CleanDirectory(p.GetPath());
+  }
   return api_c_.RemoveFile(p.GetPath());
 }
+
+int PoolsetManagement::PreallocateParts(
+    const Poolset &p, std::vector<part_preallocation> &stats) {
+  std::map<dev_t, std::vector<const Part *>> devices;
+  for (const auto &replica : p.GetReplicas()) {
+    for (const auto &part : replica.GetParts()) {
+      /* files of directory parts are created by the library */
+      if (part.IsDirectory()) {
+        continue;
+      }
+      const std::string &path = part.GetPath();
+      std::string dir = path.substr(0, path.rfind('/') + 1);
+      struct stat st;
+      if (stat(dir.empty() ? "." : dir.c_str(), &st) != 0) {
+        std::cerr << "Cannot stat " << dir << ": " << std::strerror(errno)
+                  << std::endl;
+        return -1;
+      }
+      devices[st.st_dev].emplace_back(&part);
+    }
+  }
+
+  std::vector<std::vector<part_preallocation>> device_stats(devices.size());
+  std::vector<std::future<int>> workers;
+  size_t i = 0;
+  for (const auto &it : devices) {
+    workers.emplace_back(std::async(std::launch::async, PreallocateDevice,
+                                    std::cref(it.second),
+                                    std::ref(device_stats[i++])));
+  }
+
+  int ret = 0;
+  for (auto &worker : workers) {
+    if (worker.get() != 0) {
+      ret = -1;
+    }
+  }
+
+  stats.clear();
+  for (const auto &device : device_stats) {
+    stats.insert(stats.end(), device.begin(), device.end());
+  }
+  return ret;
+}
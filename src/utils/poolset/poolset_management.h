@@ -1,5 +1,5 @@
 /*
- * Copyright 2017, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -33,8 +33,24 @@
 #ifndef PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_MANAGEMENT_H_
 #define PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_MANAGEMENT_H_
 
+#include <string>
+#include <vector>
 #include "poolset.h"
 
+struct part_preallocation {
+  std::string path;
+  size_t size;
+  double duration_ms;
+
+  /*
+   * GetBandwidth -- returns allocation bandwidth of the part in MiB/s.
+   */
+  double GetBandwidth() const {
+    return duration_ms > 0 ? size / (1024.0 * 1024.0) / (duration_ms / 1000)
+                           : 0;
+  }
+};
+
 class PoolsetManagement final {
  private:
   ApiC api_c_;
@@ -49,7 +65,25 @@ class PoolsetManagement final {
   int CreatePoolsetFile(const Poolset &p);
   int RemovePoolsetFile(const Poolset &p);
   int RemovePartsFromPoolset(const Poolset &p);
+  /*
+   * RemovePart -- removes part file or all files of directory part.
+   */
   int RemovePart(const Part &p);
+
+  /*
+   * PreallocateParts -- creates all parts of the pool set and allocates their
+   * blocks with posix_fallocate. Directory parts are skipped. Parts placed on
+   * the same device are allocated one after another by a single worker,
+   * different devices are handled concurrently. Allocation time of every part
+   * is stored in 'stats'. Returns 0 on success, prints error message and
+   * returns -1 otherwise.
+   */
+  int PreallocateParts(const Poolset &p,
+                       std::vector<part_preallocation> &stats);
+  int PreallocateParts(const Poolset &p) {
+    std::vector<part_preallocation> stats;
+    return PreallocateParts(p, stats);
+  }
 };
 
 #endif  // !PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_MANAGEMENT_H_
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "poolset_parser.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+namespace {
+const size_t MAX_TOKENS = 3;
+
+struct token {
+  const char *str;
+  size_t len;
+
+  bool Equals(const char *literal) const {
+    return len == std::strlen(literal) && std::memcmp(str, literal, len) == 0;
+  }
+};
+
+/*
+ * Tokenize -- splits line given by [begin, end) into tokens separated by
+ * blanks, skipping comment. Returns number of tokens found, MAX_TOKENS + 1 if
+ * there are more.
+ */
+size_t Tokenize(const char *begin, const char *end,
+                token (&tokens)[MAX_TOKENS]) {
+  size_t count = 0;
+  const char *p = begin;
+  while (p < end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+      ++p;
+    }
+    if (p == end || *p == '#') {
+      break;
+    }
+    const char *start = p;
+    while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '#') {
+      ++p;
+    }
+    if (count == MAX_TOKENS) {
+      return MAX_TOKENS + 1;
+    }
+    tokens[count++] = token{start, static_cast<size_t>(p - start)};
+  }
+  return count;
+}
+}  // namespace
+
+int PoolsetParser::Parse(const std::string &path, Poolset &poolset) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    std::cerr << "Cannot open " << path << ": " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    std::cerr << "Cannot read size of " << path << " or file is empty"
+              << std::endl;
+    close(fd);
+    return -1;
+  }
+
+  size_t len = static_cast<size_t>(st.st_size);
+  void *addr = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    std::cerr << "Cannot map " << path << ": " << std::strerror(errno)
+              << std::endl;
+    return -1;
+  }
+
+  size_t slash = path.rfind('/');
+  std::string dir = slash == std::string::npos ? "." : path.substr(0, slash);
+  std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+
+  int ret = Parse(static_cast<const char *>(addr), len, dir, name, poolset);
+  munmap(addr, len);
+  if (ret != 0) {
+    std::cerr << "Parsing " << path << " failed" << std::endl;
+  }
+  return ret;
+}
+
+int PoolsetParser::Parse(const char *data, size_t len, const std::string &dir,
+                         const std::string &name, Poolset &poolset) {
+  std::vector<Replica> replicas;
+  std::vector<std::string> headers;
+  std::vector<std::vector<Part>> parts;
+  std::vector<PoolsetOption> options;
+
+  const char *end = data + len;
+  const char *line = data;
+  for (unsigned line_no = 1; line < end; ++line_no) {
+    const char *eol =
+        static_cast<const char *>(std::memchr(line, '\n', end - line));
+    if (eol == nullptr) {
+      eol = end;
+    }
+
+    token tokens[MAX_TOKENS];
+    size_t count = Tokenize(line, eol, tokens);
+    line = eol + 1;
+    if (count == 0) {
+      continue;
+    }
+
+    if (headers.empty()) {
+      if (count != 1 || !tokens[0].Equals("PMEMPOOLSET")) {
+        std::cerr << "Line " << line_no << ": PMEMPOOLSET header expected"
+                  << std::endl;
+        return -1;
+      }
+      headers.emplace_back("PMEMPOOLSET");
+      parts.emplace_back();
+    } else if (tokens[0].Equals("REPLICA")) {
+      if (count != 1) {
+        std::cerr << "Line " << line_no << ": remote replicas are not supported"
+                  << std::endl;
+        return -1;
+      }
+      if (parts.back().empty()) {
+        std::cerr << "Line " << line_no << ": replica without parts"
+                  << std::endl;
+        return -1;
+      }
+      headers.emplace_back("REPLICA");
+      parts.emplace_back();
+    } else if (tokens[0].Equals("OPTION")) {
+      if (count != 2 || headers.size() != 1 ||
+          !(tokens[1].Equals("SINGLEHDR") || tokens[1].Equals("NOHDRS"))) {
+        std::cerr << "Line " << line_no << ": unsupported option" << std::endl;
+        return -1;
+      }
+      options.emplace_back(tokens[1].Equals("SINGLEHDR")
+                               ? PoolsetOption::singlehdr
+                               : PoolsetOption::nohdrs);
+    } else if (tokens[0].Equals("PMEMPOOLSET")) {
+      std::cerr << "Line " << line_no << ": duplicated PMEMPOOLSET header"
+                << std::endl;
+      return -1;
+    } else {
+      size_t size;
+      SizeUnit unit;
+      if (count != 2 ||
+          Part::ParseSize(tokens[0].str, tokens[0].len, size, unit) != 0) {
+        std::cerr << "Line " << line_no << ": invalid part definition"
+                  << std::endl;
+        return -1;
+      }
+      parts.back().emplace_back(size, unit,
+                                std::string(tokens[1].str, tokens[1].len));
+    }
+  }
+
+  if (parts.empty() || parts.back().empty()) {
+    std::cerr << "Pool set " << name << " has no parts in last replica"
+              << std::endl;
+    return -1;
+  }
+
+  replicas.reserve(parts.size());
+  for (size_t i = 0; i < parts.size(); ++i) {
+    replicas.emplace_back(headers[i], std::move(parts[i]), static_cast<int>(i));
+  }
+  poolset = Poolset{dir, name, std::move(replicas), std::move(options)};
+  return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_PARSER_H_
+#define PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_PARSER_H_
+
+#include <string>
+#include "poolset.h"
+
+/*
+ * PoolsetParser -- class that reads existing pool set files into Poolset.
+ * Content is tokenized in place, only part paths are copied. Comments, empty
+ * lines and any amount of blanks between tokens are accepted. SINGLEHDR and
+ * NOHDRS options are accepted in master replica section. Remote replicas are
+ * not supported.
+ */
+class PoolsetParser final {
+ public:
+  /*
+   * Parse -- memory-maps pool set file under given path and parses it into
+   * 'poolset'. Returns 0 on success, prints error message and returns -1
+   * otherwise.
+   */
+  static int Parse(const std::string &path, Poolset &poolset);
+
+  /*
+   * Parse -- parses 'len' bytes of pool set file content. Resulting poolset is
+   * placed in 'dir' under 'name'. Returns 0 on success, prints error message
+   * with line number and returns -1 otherwise.
+   */
+  static int Parse(const char *data, size_t len, const std::string &dir,
+                   const std::string &name, Poolset &poolset);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_PARSER_H_
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "poolset_validator.h"
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <map>
+
+namespace {
+/*
+ * batch -- consecutive statuses of parts placed in the same directory.
+ */
+struct batch {
+  const std::string *dir;
+  std::vector<part_status *> statuses;
+};
+
+/*
+ * StatAt -- reads attributes of file 'name' relative to 'dirfd'. Returns 0 on
+ * success, errno otherwise.
+ */
+int StatAt(int dirfd, const char *name, part_status &status) {
+#ifdef STATX_BASIC_STATS
+  const unsigned mask = STATX_TYPE | STATX_MODE | STATX_SIZE;
+  struct statx stx;
+  if (statx(dirfd, name, AT_STATX_SYNC_AS_STAT, mask, &stx) != 0) {
+    return errno;
+  }
+  status.mode = stx.stx_mode;
+  status.size = stx.stx_size;
+#else
+  struct stat64 st;
+  if (fstatat64(dirfd, name, &st, 0) != 0) {
+    return errno;
+  }
+  status.mode = st.st_mode;
+  status.size = st.st_size;
+#endif
+  return 0;
+}
+
+/*
+ * StatBatch -- reads attributes of all parts in the batch opening their
+ * directory once. Returns 0 on success, -1 if the directory exists but cannot
+ * be opened.
+ */
+int StatBatch(const batch &b) {
+  const char *dir = b.dir->empty() ? "." : b.dir->c_str();
+  int dirfd = open(dir, O_PATH | O_DIRECTORY | O_CLOEXEC);
+  if (dirfd == -1) {
+    int error = errno;
+    for (auto status : b.statuses) {
+      status->error = error;
+    }
+    if (error == ENOENT || error == ENOTDIR) {
+      return 0;
+    }
+    std::cerr << "Cannot open " << dir << ": " << std::strerror(error)
+              << std::endl;
+    return -1;
+  }
+
+  for (auto status : b.statuses) {
+    const std::string &path = status->part->GetPath();
+    std::string name = path.substr(b.dir->size());
+    status->error = StatAt(dirfd, name.empty() ? "." : name.c_str(), *status);
+    if (status->error == 0) {
+      status->exists = status->part->IsDirectory() ? S_ISDIR(status->mode)
+                                                   : S_ISREG(status->mode);
+    }
+  }
+  close(dirfd);
+  return 0;
+}
+
+/*
+ * GetDirectory -- returns directory of the part including trailing slash.
+ * Directory part is looked up in its parent directory.
+ */
+std::string GetDirectory(const Part &part) {
+  const std::string &path = part.GetPath();
+  size_t end = part.IsDirectory() ? path.size() - 1 : path.size();
+  size_t slash = end == 0 ? std::string::npos : path.rfind('/', end - 1);
+  return slash == std::string::npos ? "" : path.substr(0, slash + 1);
+}
+}  // namespace
+
+int PoolsetValidator::Stat(const Poolset &p,
+                           std::vector<part_status> &statuses) const {
+  size_t count = 0;
+  for (const auto &replica : p.GetReplicas()) {
+    count += replica.GetParts().size();
+  }
+  statuses.assign(count, part_status{});
+
+  std::map<std::string, std::vector<part_status *>> dirs;
+  size_t i = 0;
+  for (const auto &replica : p.GetReplicas()) {
+    for (const auto &part : replica.GetParts()) {
+      statuses[i].part = &part;
+      dirs[GetDirectory(part)].emplace_back(&statuses[i++]);
+    }
+  }
+
+  std::vector<batch> batches;
+  for (const auto &it : dirs) {
+    for (size_t first = 0; first < it.second.size(); first += batch_size_) {
+      auto begin = it.second.begin() + first;
+      auto end = it.second.begin() +
+                 std::min(first + batch_size_, it.second.size());
+      batches.emplace_back(
+          batch{&it.first, std::vector<part_status *>(begin, end)});
+    }
+  }
+
+  std::atomic<size_t> next{0};
+  auto worker = [&batches, &next]() {
+    int ret = 0;
+    for (size_t b = next++; b < batches.size(); b = next++) {
+      ret |= StatBatch(batches[b]);
+    }
+    return ret;
+  };
+
+  size_t count_workers =
+      std::min(static_cast<size_t>(workers_), batches.size());
+  std::vector<std::future<int>> workers;
+  for (size_t w = 1; w < count_workers; ++w) {
+    workers.emplace_back(std::async(std::launch::async, worker));
+  }
+
+  int ret = count_workers > 0 ? worker() : 0;
+  for (auto &w : workers) {
+    ret |= w.get();
+  }
+  return ret == 0 ? 0 : -1;
+}
+
+int PoolsetValidator::Validate(const Poolset &p, int mode) const {
+  std::vector<part_status> statuses;
+  if (Stat(p, statuses) != 0) {
+    return -1;
+  }
+
+  int ret = 0;
+  for (const auto &status : statuses) {
+    if (!status.exists) {
+      std::cerr << "Missing part " << status.part->GetPath() << ": "
+                << (status.error != 0 ? std::strerror(status.error)
+                                      : "wrong file type")
+                << std::endl;
+      ret = -1;
+    }
+  }
+  if (ret == -1) {
+    std::cerr << "Part's from the pool set file are missing" << std::endl;
+    return -1;
+  }
+
+  for (const auto &status : statuses) {
+    if (!status.part->IsDirectory() && status.part->GetSize() != status.size) {
+      std::cerr << "Part's size mismatch\n"
+                << status.part->GetPath()
+                << "\nExpected: " << status.part->GetSizeString()
+                << "\nActual: " << status.size << std::endl;
+      ret = -1;
+    }
+  }
+  if (ret == -1) {
+    return -1;
+  }
+
+  for (const auto &status : statuses) {
+    if (!status.part->IsDirectory() && mode != status.mode) {
+      std::cerr << "Part's permission mismatch\n"
+                << status.part->GetPath() << "\nExpected: " << mode
+                << "\nActual: " << status.mode << std::endl;
+      ret = -1;
+    }
+  }
+  return ret;
+}
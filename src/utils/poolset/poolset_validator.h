@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_VALIDATOR_H_
+#define PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_VALIDATOR_H_
+
+#include <vector>
+#include "poolset.h"
+
+/*
+ * part_status -- attributes of a part read by PoolsetValidator. 'error' holds
+ * errno of failed lookup, 0 if the part was found.
+ */
+struct part_status {
+  const Part *part = nullptr;
+  bool exists = false;
+  size_t size = 0;
+  unsigned short mode = 0;
+  int error = 0;
+};
+
+/*
+ * PoolsetValidator -- class that checks parts of the pool set against the pool
+ * set file. Existence, size and mode of every part are read with a single
+ * statx call relative to descriptor of the part's directory, so each directory
+ * is resolved once. Directories are split into batches handled concurrently,
+ * which hides latency of network attached file systems.
+ */
+class PoolsetValidator final {
+ private:
+  unsigned workers_;
+  size_t batch_size_;
+
+ public:
+  explicit PoolsetValidator(unsigned workers = 16, size_t batch_size = 64)
+      : workers_(workers > 0 ? workers : 1),
+        batch_size_(batch_size > 0 ? batch_size : 1) {
+  }
+
+  /*
+   * Stat -- reads attributes of all parts of the pool set. Statuses are stored
+   * in order of parts in the pool set file and point to parts of 'p', which
+   * must outlive them. Returns 0 on success, prints error message and returns
+   * -1 if a directory of parts could not be opened for reason other than its
+   * absence.
+   */
+  int Stat(const Poolset &p, std::vector<part_status> &statuses) const;
+
+  /*
+   * Validate -- checks that all parts exist, sizes of parts are correct and
+   * 'mode' is set. Size and mode of directory parts are not checked. Returns 0
+   * on success, prints error message and returns -1 otherwise.
+   */
+  int Validate(const Poolset &p, int mode) const;
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_POOLSET_POOLSET_VALIDATOR_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -31,7 +31,6 @@
  */
 
 #include "replica.h"
-#include <sstream>
 
 Replica::Replica(std::vector<std::string> content, const std::string &path,
                  int count)
@@ -55,13 +54,14 @@ Replica::Replica(std::vector<std::string> content, const std::string &path,
 }
 
 std::vector<std::string> Replica::Split(const std::string &str) const {
-  const char DELIMITER = ' ';
+  const char *DELIMITERS = " \t";
   std::vector<std::string> vec;
 
-  std::istringstream stream(str);
-  std::string token;
-  while (std::getline(stream, token, DELIMITER)) {
-    vec.push_back(token);
+  size_t begin = str.find_first_not_of(DELIMITERS);
+  while (begin != std::string::npos) {
+    size_t end = str.find_first_of(DELIMITERS, begin);
+    vec.emplace_back(str, begin, end == std::string::npos ? end : end - begin);
+    begin = str.find_first_not_of(DELIMITERS, end);
   }
   return vec;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2018, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -33,6 +33,7 @@
 #ifndef PMDK_TESTS_SRC_UTILS_POOLSET_REPLICA_H_
 #define PMDK_TESTS_SRC_UTILS_POOLSET_REPLICA_H_
 
+#include <utility>
 #include <vector>
 #include "part.h"
 
@@ -54,6 +55,12 @@ class Replica final {
 
  public:
   Replica(std::vector<std::string> content, const std::string &path, int count);
+  Replica(const std::string &header, std::vector<Part> parts, int count)
+      : header_(header),
+        parts_(std::move(parts)),
+        count_(count),
+        part_count_(static_cast<int>(parts_.size())) {
+  }
   const std::string &GetHeader() const {
     return this->header_;
   };
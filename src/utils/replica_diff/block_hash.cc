@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "block_hash.h"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BLOCK_HASH_X86 1
+#endif
+
+namespace {
+const size_t LANES = BlockHash::STRIPE_SIZE / sizeof(uint64_t);
+const size_t KEYS = BlockHash::KEY_WINDOW / sizeof(uint64_t);
+const uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+
+typedef std::array<uint64_t, KEYS> key_table;
+
+/*
+ * Mix -- finalization step of MurmurHash3, spreads every input bit over the
+ * whole result.
+ */
+uint64_t Mix(uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  x *= 0xC4CEB9FE1A85EC53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+key_table GenerateKeys() {
+  key_table keys;
+  uint64_t state = PRIME_1;
+  for (auto &key : keys) {
+    state += 0x9E3779B97F4A7C15ULL;
+    key = Mix(state);
+  }
+  return keys;
+}
+
+const key_table &GetKeys() {
+  static const key_table keys = GenerateKeys();
+  return keys;
+}
+
+/*
+ * AccumulateScalar -- accumulates 'stripes' full stripes of data starting at
+ * key index 'key' in 'acc'.
+ */
+void AccumulateScalar(uint64_t *acc, const unsigned char *data, size_t stripes,
+                      size_t key) {
+  const key_table &keys = GetKeys();
+  for (size_t s = 0; s < stripes; ++s, key = (key + LANES) % KEYS) {
+    for (size_t l = 0; l < LANES; ++l) {
+      uint64_t w;
+      std::memcpy(&w, data + s * BlockHash::STRIPE_SIZE + l * sizeof(w),
+                  sizeof(w));
+      uint64_t k = w ^ keys[key + l];
+      acc[l] += (k & 0xFFFFFFFFULL) * (k >> 32) + w;
+    }
+  }
+}
+
+#ifdef BLOCK_HASH_X86
+__attribute__((target("avx2"))) void AccumulateAvx2(uint64_t *acc,
+                                                    const unsigned char *data,
+                                                    size_t stripes,
+                                                    size_t key) {
+  const key_table &keys = GetKeys();
+  __m256i acc_lo = _mm256_loadu_si256(reinterpret_cast<__m256i *>(acc));
+  __m256i acc_hi = _mm256_loadu_si256(reinterpret_cast<__m256i *>(acc + 4));
+  for (size_t s = 0; s < stripes; ++s, key = (key + LANES) % KEYS) {
+    const __m256i *src = reinterpret_cast<const __m256i *>(
+        data + s * BlockHash::STRIPE_SIZE);
+    const __m256i *k = reinterpret_cast<const __m256i *>(&keys[key]);
+    __m256i w_lo = _mm256_loadu_si256(src);
+    __m256i w_hi = _mm256_loadu_si256(src + 1);
+    __m256i k_lo = _mm256_xor_si256(w_lo, _mm256_loadu_si256(k));
+    __m256i k_hi = _mm256_xor_si256(w_hi, _mm256_loadu_si256(k + 1));
+    /* _mm256_mul_epu32 multiplies low halves of 64-bit elements */
+    __m256i p_lo = _mm256_mul_epu32(k_lo, _mm256_srli_epi64(k_lo, 32));
+    __m256i p_hi = _mm256_mul_epu32(k_hi, _mm256_srli_epi64(k_hi, 32));
+    acc_lo = _mm256_add_epi64(acc_lo, _mm256_add_epi64(p_lo, w_lo));
+    acc_hi = _mm256_add_epi64(acc_hi, _mm256_add_epi64(p_hi, w_hi));
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc), acc_lo);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + 4), acc_hi);
+}
+#endif
+
+typedef void (*accumulate_fn)(uint64_t *, const unsigned char *, size_t,
+                              size_t);
+
+/*
+ * HashWith -- hashes full stripes with given accumulate function. The last
+ * incomplete stripe is padded with zeros and hashed by the scalar one.
+ */
+uint64_t HashWith(accumulate_fn accumulate, const void *data, size_t len) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  uint64_t acc[LANES];
+  for (size_t l = 0; l < LANES; ++l) {
+    acc[l] = PRIME_2 * (l + 1);
+  }
+
+  size_t stripes = len / BlockHash::STRIPE_SIZE;
+  accumulate(acc, bytes, stripes, 0);
+
+  size_t tail = len % BlockHash::STRIPE_SIZE;
+  if (tail != 0) {
+    unsigned char last[BlockHash::STRIPE_SIZE] = {0};
+    std::memcpy(last, bytes + stripes * BlockHash::STRIPE_SIZE, tail);
+    AccumulateScalar(acc, last, 1, stripes * LANES % KEYS);
+  }
+
+  uint64_t h = len * PRIME_1;
+  for (size_t l = 0; l < LANES; ++l) {
+    h = Mix(h ^ acc[l]) + PRIME_2;
+  }
+  return h;
+}
+}  // namespace
+
+uint64_t BlockHash::Hash(const void *data, size_t len) {
+  static const bool simd = IsSimdAvailable();
+  return simd ? HashSimd(data, len) : HashScalar(data, len);
+}
+
+uint64_t BlockHash::HashScalar(const void *data, size_t len) {
+  return HashWith(AccumulateScalar, data, len);
+}
+
+uint64_t BlockHash::HashSimd(const void *data, size_t len) {
+#ifdef BLOCK_HASH_X86
+  return HashWith(AccumulateAvx2, data, len);
+#else
+  return HashWith(AccumulateScalar, data, len);
+#endif
+}
+
+bool BlockHash::IsSimdAvailable() {
+#ifdef BLOCK_HASH_X86
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+uint64_t BlockHash::Combine(uint64_t left, uint64_t right) {
+  return Mix(left * PRIME_1 ^ Mix(right + PRIME_2));
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef PMDK_TESTS_SRC_UTILS_REPLICA_DIFF_BLOCK_HASH_H_
+#define PMDK_TESTS_SRC_UTILS_REPLICA_DIFF_BLOCK_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "constants.h"
+
+/*
+ * BlockHash -- non-cryptographic 64-bit hash of data blocks. Block is read in
+ * 64-byte stripes accumulated in eight independent 64-bit lanes, which maps
+ * onto two AVX2 registers. Every word is mixed with key depending on its
+ * position in 4 KiB window, so data moved within the window changes the hash.
+ * AVX2 and scalar implementations return the same values, so hashes saved on
+ * one machine can be compared on another.
+ */
+class BlockHash final {
+ public:
+  static const size_t STRIPE_SIZE = 64;
+  static const size_t KEY_WINDOW = 4 * KIBIBYTE;
+
+  /*
+   * Hash -- returns hash of given data computed with AVX2 if the CPU supports
+   * it, with scalar implementation otherwise.
+   */
+  static uint64_t Hash(const void *data, size_t len);
+
+  static uint64_t HashScalar(const void *data, size_t len);
+
+  /*
+   * HashSimd -- returns hash of given data computed with AVX2. Must not be
+   * called if IsSimdAvailable() returns false.
+   */
+  static uint64_t HashSimd(const void *data, size_t len);
+
+  static bool IsSimdAvailable();
+
+  /*
+   * Combine -- returns hash of node with given children hashes.
+   */
+  static uint64_t Combine(uint64_t left, uint64_t right);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_REPLICA_DIFF_BLOCK_HASH_H_
@@ -0,0 +1,348 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "merkle_tree.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include "api_c/api_c.h"
+
+const char MerkleTree::MAGIC[8] = {'P', 'M', 'D', 'K', 'M', 'R', 'K', 'L'};
+const size_t MerkleTree::BLOCK_SIZE;
+
+namespace {
+/*
+ * mapped_segment -- segment mapped read-only into memory, 'start' is offset of
+ * the segment in hashed data.
+ */
+struct mapped_segment {
+  const unsigned char *addr;
+  uint64_t start;
+  uint64_t length;
+};
+
+/*
+ * Map -- maps given segment. Returns 0 on success, prints error message and
+ * returns -1 otherwise. Mapping of zero length has no address.
+ */
+int Map(const data_segment &segment, void *&mapping, size_t &mapping_len,
+        mapped_segment &mapped) {
+  int fd = open(segment.path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    std::cerr << "Opening " << segment.path
+              << " failed: " << std::strerror(errno) << std::endl;
+    return -1;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    std::cerr << "Cannot stat " << segment.path << ": "
+              << std::strerror(errno) << std::endl;
+    close(fd);
+    return -1;
+  }
+
+  uint64_t file_size = static_cast<uint64_t>(st.st_size);
+  uint64_t end = segment.length == 0 ? file_size
+                                     : segment.offset + segment.length;
+  if (segment.offset > file_size || end > file_size) {
+    std::cerr << segment.path << " is smaller than hashed segment"
+              << std::endl;
+    close(fd);
+    return -1;
+  }
+
+  uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  uint64_t map_offset = segment.offset / page * page;
+  mapped.length = end - segment.offset;
+  mapping = nullptr;
+  mapping_len = static_cast<size_t>(end - map_offset);
+  if (mapped.length > 0) {
+    mapping = mmap(nullptr, mapping_len, PROT_READ, MAP_SHARED, fd,
+                   static_cast<off_t>(map_offset));
+    if (mapping == MAP_FAILED) {
+      std::cerr << "Mapping " << segment.path
+                << " failed: " << std::strerror(errno) << std::endl;
+      close(fd);
+      return -1;
+    }
+    madvise(mapping, mapping_len, MADV_SEQUENTIAL);
+  }
+  close(fd);
+  mapped.addr = static_cast<const unsigned char *>(mapping) +
+                (segment.offset - map_offset);
+  return 0;
+}
+
+/*
+ * HashBlocks -- computes hashes of blocks [first, last). Block crossing border
+ * of segments is gathered into a buffer.
+ */
+void HashBlocks(const std::vector<mapped_segment> &segments,
+                uint64_t data_size, size_t first, size_t last,
+                std::vector<uint64_t> &hashes) {
+  auto starts_after = [](uint64_t offset, const mapped_segment &s) {
+    return offset < s.start;
+  };
+  auto seg = std::upper_bound(
+      segments.begin(), segments.end(),
+      static_cast<uint64_t>(first) * MerkleTree::BLOCK_SIZE, starts_after);
+  --seg;
+
+  unsigned char buffer[MerkleTree::BLOCK_SIZE];
+  for (size_t b = first; b < last; ++b) {
+    uint64_t offset = static_cast<uint64_t>(b) * MerkleTree::BLOCK_SIZE;
+    size_t len = static_cast<size_t>(
+        std::min<uint64_t>(MerkleTree::BLOCK_SIZE, data_size - offset));
+    while (offset >= seg->start + seg->length) {
+      ++seg;
+    }
+
+    if (offset + len <= seg->start + seg->length) {
+      hashes[b] = BlockHash::Hash(seg->addr + (offset - seg->start), len);
+      continue;
+    }
+
+    size_t copied = 0;
+    for (auto s = seg; copied < len; ++s) {
+      uint64_t from = offset + copied - s->start;
+      size_t n = static_cast<size_t>(
+          std::min<uint64_t>(len - copied, s->length - from));
+      std::memcpy(buffer + copied, s->addr + from, n);
+      copied += n;
+    }
+    hashes[b] = BlockHash::Hash(buffer, len);
+  }
+}
+}  // namespace
+
+void MerkleTree::BuildNodes() {
+  levels_.resize(1);
+  while (levels_.back().size() > 1) {
+    const std::vector<uint64_t> &children = levels_.back();
+    std::vector<uint64_t> nodes((children.size() + 1) / 2);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      /* the last odd child is promoted to its parent */
+      nodes[i] = 2 * i + 1 < children.size()
+                     ? BlockHash::Combine(children[2 * i], children[2 * i + 1])
+                     : children[2 * i];
+    }
+    levels_.emplace_back(std::move(nodes));
+  }
+}
+
+int MerkleTree::Build(const std::vector<data_segment> &segments,
+                      uint64_t base_offset, MerkleTree &tree,
+                      unsigned workers) {
+  std::vector<std::pair<void *, size_t>> mappings;
+  std::vector<mapped_segment> mapped;
+  uint64_t data_size = 0;
+  int ret = 0;
+  for (const auto &segment : segments) {
+    void *mapping;
+    size_t mapping_len;
+    mapped_segment m;
+    if (Map(segment, mapping, mapping_len, m) != 0) {
+      ret = -1;
+      break;
+    }
+    if (m.length == 0) {
+      continue;
+    }
+    mappings.emplace_back(mapping, mapping_len);
+    m.start = data_size;
+    data_size += m.length;
+    mapped.emplace_back(m);
+  }
+
+  if (ret == 0) {
+    size_t blocks = static_cast<size_t>((data_size + BLOCK_SIZE - 1) /
+                                        BLOCK_SIZE);
+    tree.base_offset_ = base_offset;
+    tree.data_size_ = data_size;
+    tree.levels_.assign(1, std::vector<uint64_t>(blocks));
+
+    if (workers == 0) {
+      workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t per_worker = (blocks + workers - 1) / workers;
+    std::vector<std::future<void>> hashing;
+    for (size_t first = 0; first < blocks; first += per_worker) {
+      hashing.emplace_back(std::async(
+          std::launch::async, HashBlocks, std::cref(mapped), data_size, first,
+          std::min(first + per_worker, blocks), std::ref(tree.levels_[0])));
+    }
+    for (auto &h : hashing) {
+      h.get();
+    }
+    tree.BuildNodes();
+  }
+
+  for (const auto &mapping : mappings) {
+    munmap(mapping.first, mapping.second);
+  }
+  return ret;
+}
+
+int MerkleTree::Build(const Poolset &poolset, unsigned replica,
+                      MerkleTree &tree, unsigned workers) {
+  if (replica >= poolset.GetReplicas().size()) {
+    std::cerr << "Pool set " << poolset.GetFullPath() << " has no replica "
+              << replica << std::endl;
+    return -1;
+  }
+
+  const std::vector<PoolsetOption> &options = poolset.GetOptions();
+  auto has_option = [&options](PoolsetOption option) {
+    return std::find(options.begin(), options.end(), option) != options.end();
+  };
+  bool no_headers = has_option(PoolsetOption::nohdrs);
+  bool single_header = has_option(PoolsetOption::singlehdr);
+
+  const std::vector<Part> &parts = poolset.GetReplica(replica).GetParts();
+  std::vector<data_segment> segments;
+  segments.reserve(parts.size());
+  for (size_t i = 0; i < parts.size(); ++i) {
+    if (parts[i].IsDirectory()) {
+      std::cerr << "Directory part " << parts[i].GetPath()
+                << " is not supported" << std::endl;
+      return -1;
+    }
+    bool has_header = !no_headers && (i == 0 || !single_header);
+    segments.emplace_back(data_segment{parts[i].GetPath(),
+                                       has_header ? POOL_HDR_SIZE : 0, 0});
+  }
+  return Build(segments, no_headers ? 0 : POOL_HDR_SIZE, tree, workers);
+}
+
+int MerkleTree::Save(const std::string &path) const {
+  uint64_t header[] = {BLOCK_SIZE, base_offset_, data_size_, GetBlocks()};
+  std::string content(MAGIC, sizeof(MAGIC));
+  content.append(reinterpret_cast<const char *>(header), sizeof(header));
+  if (!levels_.empty()) {
+    content.append(reinterpret_cast<const char *>(levels_.front().data()),
+                   levels_.front().size() * sizeof(uint64_t));
+  }
+  /* snapshot is read after power cycle, so it has to reach storage */
+  if (ApiC::CreateFileDurably(path, content) != 0) {
+    std::cerr << "Saving tree to " << path << " failed" << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+int MerkleTree::Load(const std::string &path, MerkleTree &tree) {
+  std::ifstream file{path, std::ios::binary};
+  char magic[sizeof(MAGIC)];
+  uint64_t header[4];
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char *>(header), sizeof(header));
+  if (!file.good() || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header[0] != BLOCK_SIZE ||
+      header[3] != (header[2] + BLOCK_SIZE - 1) / BLOCK_SIZE) {
+    std::cerr << path << " is not a valid tree file" << std::endl;
+    return -1;
+  }
+
+  tree.base_offset_ = header[1];
+  tree.data_size_ = header[2];
+  tree.levels_.assign(1, std::vector<uint64_t>(header[3]));
+  file.read(reinterpret_cast<char *>(tree.levels_[0].data()),
+            tree.levels_[0].size() * sizeof(uint64_t));
+  if (!file.good()) {
+    std::cerr << "Reading tree from " << path << " failed" << std::endl;
+    return -1;
+  }
+  tree.BuildNodes();
+  return 0;
+}
+
+void MerkleTree::Diff(const MerkleTree &other, size_t level, size_t index,
+                      size_t blocks, std::vector<size_t> &diverging) const {
+  if ((index << level) >= blocks) {
+    return;
+  }
+  if (level < levels_.size() && level < other.levels_.size() &&
+      levels_[level][index] == other.levels_[level][index]) {
+    return;
+  }
+  if (level == 0) {
+    diverging.push_back(index);
+    return;
+  }
+  Diff(other, level - 1, 2 * index, blocks, diverging);
+  Diff(other, level - 1, 2 * index + 1, blocks, diverging);
+}
+
+std::vector<diff_range> MerkleTree::Diff(const MerkleTree &other) const {
+  std::vector<diff_range> ranges;
+  uint64_t size = std::min(data_size_, other.data_size_);
+  size_t blocks = static_cast<size_t>((size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  std::vector<size_t> diverging;
+  Diff(other, std::max(levels_.size(), other.levels_.size()) - 1, 0, blocks,
+       diverging);
+
+  for (auto block : diverging) {
+    uint64_t offset = static_cast<uint64_t>(block) * BLOCK_SIZE;
+    uint64_t length = std::min<uint64_t>(BLOCK_SIZE, size - offset);
+    if (!ranges.empty() &&
+        ranges.back().offset + ranges.back().length == base_offset_ + offset) {
+      ranges.back().length += length;
+    } else {
+      ranges.emplace_back(diff_range{base_offset_ + offset, length});
+    }
+  }
+  return ranges;
+}
+
+uint64_t MerkleTree::GetDiffSize(const std::vector<diff_range> &ranges) {
+  uint64_t size = 0;
+  for (const auto &range : ranges) {
+    size += range.length;
+  }
+  return size;
+}
+
+std::string MerkleTree::ToString(const diff_range &range) {
+  std::stringstream ss;
+  ss << "0x" << std::hex << range.offset << "-0x"
+     << range.offset + range.length << std::dec << " (" << range.length
+     << " bytes)";
+  return ss.str();
+}
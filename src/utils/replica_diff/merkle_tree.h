@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef PMDK_TESTS_SRC_UTILS_REPLICA_DIFF_MERKLE_TREE_H_
+#define PMDK_TESTS_SRC_UTILS_REPLICA_DIFF_MERKLE_TREE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "block_hash.h"
+#include "poolset/poolset.h"
+
+/*
+ * data_segment -- range of file hashed as a part of contiguous data. Segment
+ * of zero length spans from 'offset' to the end of the file.
+ */
+struct data_segment {
+  std::string path;
+  uint64_t offset;
+  uint64_t length;
+};
+
+/*
+ * diff_range -- range of bytes that differs between two compared trees.
+ */
+struct diff_range {
+  uint64_t offset;
+  uint64_t length;
+};
+
+/*
+ * MerkleTree -- class that keeps hashes of all 4 KiB blocks of data and
+ * hashes of nodes combining them pairwise up to the single root. Trees of
+ * identical data have equal roots, trees of different data are compared
+ * descending only into differing subtrees.
+ */
+class MerkleTree final {
+ private:
+  static const char MAGIC[8];
+  uint64_t base_offset_ = 0;
+  uint64_t data_size_ = 0;
+  /* levels_[0] holds hashes of blocks, levels_.back() holds the root */
+  std::vector<std::vector<uint64_t>> levels_;
+
+  void BuildNodes();
+  void Diff(const MerkleTree &other, size_t level, size_t index,
+            size_t blocks, std::vector<size_t> &diverging) const;
+
+ public:
+  static const size_t BLOCK_SIZE = 4 * KIBIBYTE;
+
+  /*
+   * Build -- builds tree of data made of given segments, hashing blocks in
+   * parallel by 'workers' threads (number of CPUs if 0). Offsets of reported
+   * ranges are counted from 'base_offset'. Returns 0 on success, prints error
+   * message and returns -1 otherwise.
+   */
+  static int Build(const std::vector<data_segment> &segments,
+                   uint64_t base_offset, MerkleTree &tree,
+                   unsigned workers = 0);
+
+  /*
+   * Build -- builds tree of pool data stored in parts of replica of given
+   * index. Part headers are skipped where pool set options leave them (in
+   * every part by default, in the first part only with SINGLEHDR, nowhere with
+   * NOHDRS), so offsets of reported ranges are offsets in the pool address
+   * space and replicas of different layout can be compared. Replicas with
+   * directory parts are not supported. Returns 0 on success, prints error
+   * message and returns -1 otherwise.
+   */
+  static int Build(const Poolset &poolset, unsigned replica, MerkleTree &tree,
+                   unsigned workers = 0);
+
+  /*
+   * Save -- writes hashes of blocks to binary file and synchronizes it with
+   * storage, so the tree can be compared with data after shutdown. Returns 0
+   * on success, prints error message and returns -1 otherwise.
+   */
+  int Save(const std::string &path) const;
+  static int Load(const std::string &path, MerkleTree &tree);
+
+  uint64_t GetRoot() const {
+    return levels_.empty() || levels_.back().empty() ? 0
+                                                     : levels_.back().front();
+  }
+  uint64_t GetDataSize() const {
+    return data_size_;
+  }
+  size_t GetBlocks() const {
+    return levels_.empty() ? 0 : levels_.front().size();
+  }
+
+  /*
+   * Diff -- returns ranges of data differing from data of 'other' tree. Only
+   * data present in both trees is compared. Adjacent differing blocks are
+   * merged into single range.
+   */
+  std::vector<diff_range> Diff(const MerkleTree &other) const;
+
+  static uint64_t GetDiffSize(const std::vector<diff_range> &ranges);
+  static std::string ToString(const diff_range &range);
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_REPLICA_DIFF_MERKLE_TREE_H_
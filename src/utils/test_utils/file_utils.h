@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2019, Intel Corporation
+ * Copyright 2017-2026, Intel Corporation
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -37,65 +37,25 @@
 #include "api_c/api_c.h"
 #include "constants.h"
 #include "poolset/poolset.h"
-#include "poolset/poolset_management.h"
+#include "poolset/poolset_validator.h"
 
 namespace file_utils {
-static inline size_t GetSize(std::string size) {
-  std::array<std::string, 9> suffix = {{"KiB", "MiB", "GiB", "KB", "MB",
-                                       "GB",  "K",   "M",   "G"}};
-  size_t pos;
-  for (const auto &suf : suffix) {
-    if ((pos = size.find(suf)) != std::string::npos) {
-      size.erase(pos);
-
-      return static_cast<size_t>(std::stoul(size)) * SIZES.at(suf);
-    }
-  }
-
-  return static_cast<size_t>(std::stoul(size));
+/*
+ * GetSize -- returns size in bytes given in pool set file format, e.g. "9MB".
+ * Throws std::invalid_argument if size cannot be parsed.
+ */
+static inline size_t GetSize(const std::string &size) {
+  return Part{size, ""}.GetSize();
 }
 
 /*
  * ValidatePoolset -- checks that all parts in poolset exist, sizes of parts are
- * correct and specified mode is set. Returns 0 on success, print error message
- * and returns -1 otherwise.
+ * correct and specified mode is set. Size and mode of directory parts are not
+ * checked. Attributes of all parts are read in one pass by PoolsetValidator.
+ * Returns 0 on success, print error message and returns -1 otherwise.
  */
 static inline int ValidatePoolset(const Poolset &poolset, int poolset_mode) {
-  PoolsetManagement p_mgmt;
-
-  if (!p_mgmt.AllFilesExist(poolset)) {
-    std::cerr << "Part's from the pool set file are missing" << std::endl;
-    return -1;
-  }
-
-  int ret = 0;
-  size_t size = 0;
-  for (const auto &part : poolset.GetParts()) {
-    size = ApiC::GetFileSize(part.GetPath());
-    if (GetSize(part.GetSize()) != size) {
-      std::cerr << "Part's size mismatch\n"
-                << part.GetPath() << "\nExpected: " << part.GetSize()
-                << "\nActual: " << size << std::endl;
-      ret = -1;
-    }
-  }
-
-  if (ret == -1) {
-    return -1;
-  }
-
-  int mode = 0;
-  for (const auto &part : poolset.GetParts()) {
-    mode = ApiC::GetFilePermission(part.GetPath());
-    if (poolset_mode != mode) {
-      std::cerr << "Part's permission mismatch\n"
-                << part.GetPath() << "\nExpected: " << poolset_mode
-                << "\nActual: " << mode << std::endl;
-      ret = -1;
-    }
-  }
-
-  return ret;
+  return PoolsetValidator{}.Validate(poolset, poolset_mode);
 }
 
 /*
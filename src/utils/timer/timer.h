@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026, Intel Corporation
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in
+ *       the documentation and/or other materials provided with the
+ *       distribution.
+ *
+ *     * Neither the name of the copyright holder nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PMDK_TESTS_SRC_UTILS_TIMER_TIMER_H_
+#define PMDK_TESTS_SRC_UTILS_TIMER_TIMER_H_
+
+#include <chrono>
+
+/*
+ * Timer -- class that measures wall time elapsed between Start() and Stop()
+ * calls with monotonic clock.
+ */
+class Timer final {
+ private:
+  std::chrono::steady_clock::time_point start_ =
+      std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point stop_ = start_;
+
+ public:
+  void Start() {
+    start_ = std::chrono::steady_clock::now();
+    stop_ = start_;
+  }
+  void Stop() {
+    stop_ = std::chrono::steady_clock::now();
+  }
+  /*
+   * GetElapsed -- returns time between last Start() and Stop() calls expressed
+   * in given std::chrono duration unit (milliseconds by default).
+   */
+  template <typename Unit = std::chrono::milliseconds>
+  double GetElapsed() const {
+    return std::chrono::duration<double, typename Unit::period>(stop_ -
+                                                                start_)
+        .count();
+  }
+};
+
+#endif  // !PMDK_TESTS_SRC_UTILS_TIMER_TIMER_H_